@@ -0,0 +1,65 @@
+/* >=====> Counting & Radix Sort Benchmark <=====< */
+//=> 2^max (argv[1], default 22) random 12-bit keys, stored as std::uint32_t and as a DSA::packed_array<12>
+//=> (2.7x smaller). Sorts them with heap::heap_sort, counting::radix_sort and counting::counting_sort,
+//=> and times a full unpack of the packed array next to get() one value at a time.
+//=> Build with: cmake -S . -B build -DCMAKE_BUILD_TYPE=Release -DBUILD_BENCHMARKS=ON (-DENABLE_NATIVE_ARCH=ON for AVX2)
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include <fmt/core.h>
+#include <packed_array.hpp>
+#include <counting.hpp>
+#include <heap.hpp>
+
+constexpr unsigned WIDTH = 12;
+
+template<class Pass>
+double time_once(Pass pass, std::uint64_t& checksum){ //=> milliseconds
+  auto start = std::chrono::steady_clock::now();
+  checksum += pass();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+void row(const char* name, const char* storage, double ms, std::uint64_t checksum){
+  fmt::print("{:>16} | {:>22} | {:>10.3f} ms   (checksum {})\n", name, storage, ms, checksum);
+}
+
+int main(int argc, char** argv){
+  size_t n = size_t(1) << ((argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 22);
+  std::mt19937_64 random(42);
+  std::vector<std::uint32_t> keys(n);
+  for(std::uint32_t& key : keys){ key = std::uint32_t(random() & ((1u << WIDTH) - 1)); }
+  DSA::packed_array<WIDTH> packed(n);
+  packed.pack(0, n, keys.data());
+  fmt::print("{} keys of {} bits: {} bytes as uint32_t, {} bytes packed\n\n", n, WIDTH, n * sizeof(std::uint32_t), packed.bytes());
+
+  fmt::print("{:>16} | {:>22} | {:>13}\n", "operation", "storage", "time");
+  std::uint64_t checksum = 0;
+  std::vector<std::uint32_t> out(n);
+  double ms = time_once([&]{ packed.unpack(0, n, out.data()); return std::uint64_t(out[n / 2]); }, checksum);
+  row("unpack", "packed_array<12>", ms, checksum);
+  ms = time_once([&]{ std::uint64_t total = 0; for(size_t i = 0; i < n; i++){ total += packed.get(i); } return total; }, checksum);
+  row("get(i) loop", "packed_array<12>", ms, checksum);
+  ms = time_once([&]{ std::uint64_t total = 0; for(std::uint64_t value : packed){ total += value; } return total; }, checksum);
+  row("iterator", "packed_array<12>", ms, checksum);
+
+  std::vector<std::uint32_t> copy = keys;
+  ms = time_once([&]{ heap::heap_sort(copy.data(), n); return std::uint64_t(copy[n / 2]); }, checksum);
+  row("heap_sort", "uint32_t", ms, checksum);
+  copy = keys;
+  ms = time_once([&]{ counting::radix_sort(copy.data(), n); return std::uint64_t(copy[n / 2]); }, checksum);
+  row("radix_sort", "uint32_t", ms, checksum);
+  copy = keys;
+  ms = time_once([&]{ counting::counting_sort(copy.data(), n); return std::uint64_t(copy[n / 2]); }, checksum);
+  row("counting_sort", "uint32_t", ms, checksum);
+  DSA::packed_array<WIDTH> sorted = packed;
+  ms = time_once([&]{ counting::counting_sort(sorted); return sorted.get(n / 2); }, checksum);
+  row("counting_sort", "packed_array<12>", ms, checksum);
+  sorted = packed;
+  ms = time_once([&]{ counting::radix_sort(sorted); return sorted.get(n / 2); }, checksum); //=> 4096 keys: dispatches to counting_sort
+  row("radix_sort", "packed_array<12>", ms, checksum);
+  return 0;
+}
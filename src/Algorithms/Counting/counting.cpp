@@ -0,0 +1,123 @@
+/* >=====> 0. Helpers <=====< */
+//=> The unsigned key radix_sort orders by: the value itself, with the sign bit flipped for signed types.
+template<class T>
+inline std::make_unsigned_t<T> radix_key(T x) noexcept {
+  using U = std::make_unsigned_t<T>;
+  if constexpr (std::is_signed_v<T>){ return U(x) ^ (U(1) << (sizeof(T) * 8 - 1)); }
+  else { return U(x); }
+}
+
+//=> An empty packed array shaped like arr (same width), for the radix sort's scratch copy.
+template<size_t Bits>
+inline DSA::packed_array<Bits> packed_like(const DSA::packed_array<Bits>& arr){
+  if constexpr (Bits != 0){ return DSA::packed_array<Bits>(arr.size()); }
+  else { return DSA::packed_array<Bits>(arr.size(), arr.width()); }
+}
+
+/* >=====> 1. Counting Sort <=====< */
+template<class T> //=> Worst = Average = Best = O(n + range), Space Complexity = O(range)
+void counting_sort(T* arr, size_t N){
+  static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "Error: Counting sort needs integer keys!");
+  using U = std::make_unsigned_t<T>;
+  if(N < 2){ return; }
+  T low = arr[0], high = arr[0];
+  for(size_t i = 1; i < N; i++){ //=> the ternaries become min/max instructions
+    low = arr[i] < low ? arr[i] : low;
+    high = high < arr[i] ? arr[i] : high;
+  }
+  size_t span = size_t(U(high) - U(low)); //=> range - 1, cannot overflow
+  if(span >= std::max(COUNTING_RANGE, N)){ radix_sort(arr, N); return; } //=> too many counters
+  std::vector<size_t> counts(span + 1);
+  for(size_t i = 0; i < N; i++){ counts[size_t(U(arr[i]) - U(low))]++; }
+  T* out = arr;
+  for(size_t key = 0; key <= span; key++){ out = std::fill_n(out, counts[key], T(U(low) + U(key))); }
+}
+
+template<class T, size_t N> //=> Worst = Average = Best = O(n + range), Space Complexity = O(range)
+void counting_sort(T (&arr)[N]){ counting_sort(static_cast<T*>(arr), N); }
+
+/* >=====> 2. Radix Sort <=====< */
+template<class T> //=> Worst = Average = Best = O(n * bytes), Space Complexity = O(n)
+void radix_sort(T* arr, size_t N){
+  static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "Error: Radix sort needs integer keys!");
+  constexpr unsigned DIGITS = (sizeof(T) * 8 + RADIX_BITS - 1) / RADIX_BITS;
+  constexpr size_t BUCKETS = size_t(1) << RADIX_BITS;
+  if(N < 2){ return; }
+
+  std::vector<size_t> counts(DIGITS * BUCKETS); //=> every digit's histogram, one pass over the keys
+  for(size_t i = 0; i < N; i++){
+    auto key = radix_key(arr[i]);
+    for(unsigned d = 0; d < DIGITS; d++){ counts[d * BUCKETS + ((key >> (d * RADIX_BITS)) & (BUCKETS - 1))]++; }
+  }
+
+  std::vector<T> scratch(N);
+  T* from = arr;
+  T* to = scratch.data();
+  for(unsigned d = 0; d < DIGITS; d++){
+    size_t* count = counts.data() + d * BUCKETS;
+    auto first = (radix_key(from[0]) >> (d * RADIX_BITS)) & (BUCKETS - 1);
+    if(count[first] == N){ continue; } //=> every key has the same digit here: nothing moves
+    size_t offset = 0;
+    for(size_t b = 0; b < BUCKETS; b++){ size_t c = count[b]; count[b] = offset; offset += c; } //=> counts become start offsets
+    for(size_t i = 0; i < N; i++){ to[count[(radix_key(from[i]) >> (d * RADIX_BITS)) & (BUCKETS - 1)]++] = from[i]; } //=> stable scatter
+    std::swap(from, to);
+  }
+  if(from != arr){ std::copy(from, from + N, arr); } //=> odd number of passes
+}
+
+template<class T, size_t N> //=> Worst = Average = Best = O(n * bytes), Space Complexity = O(n)
+void radix_sort(T (&arr)[N]){ radix_sort(static_cast<T*>(arr), N); }
+
+/* >=====> 3. Packed Arrays <=====< */
+template<size_t Bits> //=> Worst = Average = Best = O(n + 2^width), Space Complexity = O(2^width)
+void counting_sort(DSA::packed_array<Bits>& arr){
+  size_t N = arr.size();
+  if(N < 2){ return; }
+  if(arr.width() >= 63 || (size_t(1) << arr.width()) > std::max(COUNTING_RANGE, N)){ radix_sort(arr); return; } //=> too many counters
+  std::vector<size_t> counts(size_t(1) << arr.width());
+  for(std::uint64_t value : arr){ counts[value]++; } //=> sequential decode
+  std::uint64_t chunk[PACKED_CHUNK];
+  size_t written = 0, filled = 0;
+  for(size_t key = 0; key < counts.size(); key++){ //=> the sorted runs, packed PACKED_CHUNK values at a time
+    for(size_t c = counts[key]; c > 0; ){
+      size_t run = std::min(c, PACKED_CHUNK - filled);
+      std::fill_n(chunk + filled, run, std::uint64_t(key));
+      filled += run;
+      c -= run;
+      if(filled == PACKED_CHUNK){ arr.pack(written, filled, chunk); written += filled; filled = 0; }
+    }
+  }
+  arr.pack(written, filled, chunk);
+}
+
+template<size_t Bits> //=> Worst = Average = Best = O(n * width / RADIX_BITS), Space Complexity = O(n * width) bits
+void radix_sort(DSA::packed_array<Bits>& arr){
+  constexpr size_t BUCKETS = size_t(1) << RADIX_BITS;
+  size_t N = arr.size();
+  if(N < 2){ return; }
+  if(arr.width() < 63 && (size_t(1) << arr.width()) <= std::max(COUNTING_RANGE, N)){ counting_sort(arr); return; } //=> few enough keys to count
+  const unsigned DIGITS = (arr.width() + RADIX_BITS - 1) / RADIX_BITS;
+
+  std::vector<size_t> counts(DIGITS * BUCKETS); //=> every digit's histogram, one sequential decode
+  for(std::uint64_t value : arr){
+    for(unsigned d = 0; d < DIGITS; d++){ counts[d * BUCKETS + ((value >> (d * RADIX_BITS)) & (BUCKETS - 1))]++; }
+  }
+
+  DSA::packed_array<Bits> scratch = packed_like(arr);
+  DSA::packed_array<Bits>* from = &arr;
+  DSA::packed_array<Bits>* to = &scratch;
+  std::uint64_t chunk[PACKED_CHUNK];
+  for(unsigned d = 0; d < DIGITS; d++){
+    size_t* count = counts.data() + d * BUCKETS;
+    if(count[(from->get(0) >> (d * RADIX_BITS)) & (BUCKETS - 1)] == N){ continue; } //=> every key has the same digit here
+    size_t offset = 0;
+    for(size_t b = 0; b < BUCKETS; b++){ size_t c = count[b]; count[b] = offset; offset += c; }
+    for(size_t i = 0; i < N; i += PACKED_CHUNK){ //=> unpack a chunk, scatter its values packed
+      size_t n = std::min(PACKED_CHUNK, N - i);
+      from->unpack(i, n, chunk);
+      for(size_t k = 0; k < n; k++){ to->set(count[(chunk[k] >> (d * RADIX_BITS)) & (BUCKETS - 1)]++, chunk[k]); }
+    }
+    std::swap(from, to);
+  }
+  if(from != &arr){ arr.swap(scratch); } //=> odd number of passes
+}
@@ -0,0 +1,51 @@
+#ifndef COUNTING_HPP
+#define COUNTING_HPP
+
+#include <cstddef> //=> for size_t
+#include <algorithm> //=> for std::fill_n & std::copy
+#include <type_traits> //=> for the key transforms
+#include <vector> //=> for the counters and the scratch buffer
+#include <DS/array/packed_array.hpp> //=> for DSA::packed_array
+
+namespace counting{
+  //=> Some Constants
+  constexpr size_t COUNTING_RANGE = 1 << 16; //=> up to this many possible keys (or N, if larger) counting sort wins, past it radix sort
+  constexpr unsigned RADIX_BITS = 8; //=> bits per radix digit: 256 counters stay in L1
+  constexpr size_t PACKED_CHUNK = 1024; //=> values decoded or encoded per step on a packed array
+
+  //=> Both sorts are for integers only and never compare two elements: they count keys, so the work is
+  //=> O(n + range) or O(n * digits) whatever the input order.
+
+  /* >=====> 1. Counting Sort <=====< */
+  //=> Counts every key in [min, max] and rewrites the array from the counts. Hands over to radix_sort
+  //=> when max - min is past max(COUNTING_RANGE, N).
+  template<class T> //=> Worst = Average = Best = O(n + range), Space Complexity = O(range)
+  void counting_sort(T* arr, size_t N);
+
+  template<class T, size_t N> //=> Worst = Average = Best = O(n + range), Space Complexity = O(range)
+  void counting_sort(T (&arr)[N]); //=> (&arr)[N] is an array reference, not a pointer.
+
+  /* >=====> 2. Radix Sort <=====< */
+  //=> Least significant digit first, RADIX_BITS at a time, ping-ponging with one scratch array. All
+  //=> digit histograms come from a single pass, and digits shared by every key are skipped. Signed
+  //=> keys are sorted with their sign bit flipped, so negatives come first.
+  template<class T> //=> Worst = Average = Best = O(n * bytes), Space Complexity = O(n)
+  void radix_sort(T* arr, size_t N);
+
+  template<class T, size_t N> //=> Worst = Average = Best = O(n * bytes), Space Complexity = O(n)
+  void radix_sort(T (&arr)[N]); //=> (&arr)[N] is an array reference, not a pointer.
+
+  /* >=====> 3. Packed Arrays <=====< */
+  //=> The same two sorts straight on DSA::packed_array, without unpacking it first: the keys are decoded
+  //=> sequentially, and written back packed (counting sort: as runs, PACKED_CHUNK values per pack call;
+  //=> radix sort: scattered into a second packed array of the same width, n * width bits).
+  template<size_t Bits> //=> Worst = Average = Best = O(n + 2^width), Space Complexity = O(2^width)
+  void counting_sort(DSA::packed_array<Bits>& arr);
+
+  template<size_t Bits> //=> Worst = Average = Best = O(n * width / RADIX_BITS), Space Complexity = O(n * width) bits
+  void radix_sort(DSA::packed_array<Bits>& arr);
+
+  #include "counting.cpp" //=> the implementaion file
+}
+
+#endif
@@ -0,0 +1,108 @@
+/* >=====> 1. Interpolation Search <=====< */
+//=> Invariant: every element before low is < key, every element from high on is >= key.
+template<class T> //=> Average = O(log log n) on uniform keys, Worst = O(log n), Space Complexity = O(1)
+size_t interpolation_lower_bound(const T* arr, T key, size_t N){
+  static_assert(std::is_arithmetic_v<T>, "interpolation needs numeric keys, use binary::lower_bound");
+  size_t low = 0, high = N;
+  while(high - low > FINISH){
+    const T& first = arr[low];
+    const T& last = arr[high - 1];
+    if(!(first < key)){ return low; }
+    if(last < key){ return high; }
+
+    //=> first < key <= last, so the guess lands inside [low, high - 1]
+    size_t length = high - low;
+    double fraction = (double(key) - double(first)) / (double(last) - double(first));
+    size_t probe = low + size_t(fraction * double(length - 1));
+    if(probe >= high){ probe = high - 1; }
+    if(arr[probe] < key){ low = probe + 1; }
+    else { high = probe; }
+
+    if(high - low > length / 2){ //=> the guard: a poor guess is followed by a bisection step
+      size_t mid = low + (high - low) / 2;
+      if(arr[mid] < key){ low = mid + 1; }
+      else { high = mid; }
+    }
+  }
+  return low + binary::lower_bound(arr + low, key, high - low);
+}
+
+template<class T> //=> Average = O(log log n) on uniform keys, Worst = O(log n), Space Complexity = O(1)
+size_t interpolation_search(const T* arr, T key, size_t N){
+  size_t index = interpolation_lower_bound(arr, key, N);
+  return (index < N && arr[index] == key) ? index : -1;
+}
+
+template<class T, size_t N> //=> (&arr)[N] is an array reference, not a pointer.
+size_t interpolation_search(T (&arr)[N], T key){
+  return interpolation_search(static_cast<const T*>(arr), key, N);
+}
+
+/* >=====> 2. Exponential (Galloping) Search <=====< */
+template<class T> //=> Worst = Average = O(log d), Best = O(1), Space Complexity = O(1)
+size_t exponential_lower_bound(const T* arr, T key, size_t N, size_t hint){
+  if(N == 0){ return 0; }
+  if(hint >= N){ hint = N - 1; }
+
+  size_t low, high; //=> the answer is in [low, high]
+  size_t bound = 1;
+  if(arr[hint] < key){ //=> gallop right, arr[hint + bound / 2] < key holds throughout
+    while(hint + bound < N && arr[hint + bound] < key){ bound *= 2; }
+    low = hint + bound / 2 + 1;
+    high = (hint + bound < N) ? hint + bound : N;
+  }
+  else { //=> gallop left, arr[hint - bound / 2] >= key holds throughout
+    while(bound <= hint && !(arr[hint - bound] < key)){ bound *= 2; }
+    low = (bound <= hint) ? hint - bound + 1 : 0;
+    high = hint - bound / 2;
+  }
+  return low + binary::lower_bound(arr + low, key, high - low);
+}
+
+template<class T> //=> Worst = Average = O(log d), Best = O(1), Space Complexity = O(1)
+size_t exponential_search(const T* arr, T key, size_t N, size_t hint){
+  size_t index = exponential_lower_bound(arr, key, N, hint);
+  return (index < N && arr[index] == key) ? index : -1;
+}
+
+template<class T, size_t N> //=> (&arr)[N] is an array reference, not a pointer.
+size_t exponential_search(T (&arr)[N], T key, size_t hint){
+  return exponential_search(static_cast<const T*>(arr), key, N, hint);
+}
+
+/* >=====> 3. Dispatcher <=====< */
+template<class T>
+typename searcher<T>::strategy searcher<T>::sample(const T* sorted, size_t N){
+  if constexpr (!std::is_arithmetic_v<T>){ return strategy::bisection; }
+  else {
+    if(N < 2 * SAMPLES || !(sorted[0] < sorted[N - 1])){ return strategy::bisection; }
+    double first = double(sorted[0]), span = double(sorted[N - 1]) - first;
+    double spacing = double(N - 1) / (SAMPLES - 1), scale = double(N - 1);
+    for(size_t s = 1; s + 1 < SAMPLES; s++){
+      size_t rank = size_t(s * spacing);
+      double guess = (double(sorted[rank]) - first) / span * scale;
+      double error = (guess > double(rank)) ? guess - double(rank) : double(rank) - guess;
+      if(error > spacing){ return strategy::bisection; }
+    }
+    return strategy::interpolation;
+  }
+}
+
+template<class T>
+size_t searcher<T>::lower_bound(const T& key) const {
+  if constexpr (std::is_arithmetic_v<T>){
+    if(chosen == strategy::interpolation){ return interpolation_lower_bound(data, key, N); }
+  }
+  return binary::lower_bound(data, key, N);
+}
+
+template<class T>
+size_t searcher<T>::lower_bound(const T& key, size_t hint) const {
+  return exponential_lower_bound(data, key, N, hint);
+}
+
+template<class T>
+size_t searcher<T>::search(const T& key) const {
+  size_t index = lower_bound(key);
+  return (index < N && data[index] == key) ? index : -1;
+}
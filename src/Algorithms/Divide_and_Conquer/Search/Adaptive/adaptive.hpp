@@ -0,0 +1,73 @@
+#ifndef ADAPTIVE_HPP
+#define ADAPTIVE_HPP
+
+#include <cstddef> //=> for size_t
+#include <type_traits> //=> for std::is_arithmetic_v
+#include <Algorithms/Divide_and_Conquer/Search/Binary/binary.hpp> //=> for the bisection steps
+
+namespace adaptive{
+  //=> Some Constants
+  constexpr size_t SAMPLES = 64; //=> keys the dispatcher samples to judge the distribution
+  constexpr size_t FINISH = 16; //=> ranges this small are finished with binary::lower_bound
+
+  /* >=====> 1. Interpolation Search <=====< */
+  //=> Guesses where the key sits from its value, so uniformly distributed keys take O(log log n)
+  //=> probes. A guarded step that fails to halve the range is followed by a bisection step, which
+  //=> caps skewed inputs at O(log n) instead of interpolation's usual O(n).
+  template<class T> //=> Average = O(log log n) on uniform keys, Worst = O(log n), Space Complexity = O(1)
+  size_t interpolation_lower_bound(const T* arr, T key, size_t N); //=> index of the first element >= key, N if there is none.
+
+  template<class T> //=> Average = O(log log n) on uniform keys, Worst = O(log n), Space Complexity = O(1)
+  size_t interpolation_search(const T* arr, T key, size_t N); //=> index of key, or -1 like binary::binary_search.
+
+  template<class T, size_t N> //=> (&arr)[N] is an array reference, not a pointer.
+  size_t interpolation_search(T (&arr)[N], T key);
+
+  /* >=====> 2. Exponential (Galloping) Search <=====< */
+  //=> Gallops 1, 2, 4, ... away from a starting hint, then bisects the last gap, so the cost depends
+  //=> on how far the answer is from the hint (d), not on n. Hint 0 is the unbounded-list search.
+  template<class T> //=> Worst = Average = O(log d), Best = O(1), Space Complexity = O(1)
+  size_t exponential_lower_bound(const T* arr, T key, size_t N, size_t hint = 0); //=> index of the first element >= key, N if there is none.
+
+  template<class T> //=> Worst = Average = O(log d), Best = O(1), Space Complexity = O(1)
+  size_t exponential_search(const T* arr, T key, size_t N, size_t hint = 0); //=> index of key, or -1 like binary::binary_search.
+
+  template<class T, size_t N> //=> (&arr)[N] is an array reference, not a pointer.
+  size_t exponential_search(T (&arr)[N], T key, size_t hint = 0);
+
+  /* >=====> 3. Dispatcher <=====< */
+  //=> Samples the array once and remembers whether interpolation pays off on it: the keys must be
+  //=> numbers, and a straight line through the first and last key must place every sample within
+  //=> one sample spacing of its real rank. Otherwise lookups bisect. A lookup that comes with a
+  //=> hint (the previous answer, a stream position) always gallops from it.
+  template<class T>
+  class searcher {
+    public:
+      enum class strategy { bisection, interpolation };
+
+    private:
+      const T* data; //=> the caller's sorted buffer
+      size_t N;
+      strategy chosen;
+
+      static strategy sample(const T* sorted, size_t N); //=> O(SAMPLES)
+
+    public:
+      /*assigning*/
+      searcher(const T* sorted, size_t N) : data(sorted), N(N), chosen(sample(sorted, N)) {}
+      template<size_t S>
+      searcher(const T (&sorted)[S]) : searcher(static_cast<const T*>(sorted), S) {} //=> (&sorted)[S] is an array reference
+
+      //searching
+      size_t lower_bound(const T& key) const; //=> with the remembered strategy
+      size_t lower_bound(const T& key, size_t hint) const; //=> galloping from hint
+      size_t search(const T& key) const; //=> index of key, or -1 like binary::binary_search
+
+      strategy uses(void) const noexcept { return chosen; }
+      size_t size(void) const noexcept { return N; }
+  };
+
+  #include "adaptive.cpp" //=> the implementaion file
+}
+
+#endif
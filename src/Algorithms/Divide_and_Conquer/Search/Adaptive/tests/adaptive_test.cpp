@@ -0,0 +1,99 @@
+/* >=====> Adaptive Search Tests <=====< */
+//=> Compares interpolation/exponential lower_bound and search, and adaptive::searcher (with and without
+//=> a hint), against std::lower_bound and std::binary_search. The inputs are uniform keys (the searcher
+//=> should interpolate), skewed keys and strings (it should bisect), runs of repeats, empty and
+//=> one-element arrays, and keys below, between and above the stored ones. Registered with ctest.
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+#include <fmt/core.h>
+#include <adaptive.hpp>
+
+template<class T>
+size_t lower(const std::vector<T>& values, const T& key){ return size_t(std::lower_bound(values.begin(), values.end(), key) - values.begin()); }
+
+template<class T>
+size_t expected(const std::vector<T>& values, const T& key){ //=> the first occurrence, or size_t(-1)
+  size_t index = lower(values, key);
+  return std::binary_search(values.begin(), values.end(), key) ? index : size_t(-1);
+}
+
+template<class T>
+bool searcher_matches(const std::vector<T>& values, const std::vector<T>& keys){
+  adaptive::searcher<T> search(values.data(), values.size());
+  size_t hint = 0;
+  for(const T& key : keys){
+    size_t index = lower(values, key);
+    if(search.lower_bound(key) != index || search.lower_bound(key, hint) != index || search.search(key) != expected(values, key)){ return false; }
+    hint = (index < values.size()) ? index : 0; //=> the previous answer, as a stream would pass it
+  }
+  return true;
+}
+
+template<class T>
+bool functions_match(const std::vector<T>& values, const std::vector<T>& keys){
+  const T* data = values.data();
+  size_t N = values.size();
+  for(const T& key : keys){
+    size_t index = lower(values, key), found = expected(values, key);
+    if(adaptive::interpolation_lower_bound(data, key, N) != index || adaptive::interpolation_search(data, key, N) != found){ return false; }
+    for(size_t hint : {size_t(0), N / 2, N ? N - 1 : 0}){
+      if(adaptive::exponential_lower_bound(data, key, N, hint) != index || adaptive::exponential_search(data, key, N, hint) != found){ return false; }
+    }
+  }
+  return searcher_matches(values, keys);
+}
+
+template<class T>
+std::vector<T> probes(const std::vector<T>& values, std::mt19937& random){ //=> every stored key, plus random ones around them
+  std::vector<T> keys(values);
+  T low = values.empty() ? T(0) : values.front(), high = values.empty() ? T(1) : values.back();
+  std::uniform_real_distribution<double> spread(double(low) - 10.0, double(high) + 10.0);
+  for(size_t i = 0; i < 2000; i++){ keys.push_back(T(spread(random))); }
+  return keys;
+}
+
+bool numbers_match(void){
+  std::mt19937 random(11);
+  std::vector<long> uniform(50000), skewed, repeats, one{5}, none;
+  for(long& value : uniform){ value = long(random() % 1000000); }
+  std::sort(uniform.begin(), uniform.end());
+  for(long i = 0; i < 3000; i++){ skewed.push_back(i * i * i); }
+  for(long i = 0; i < 4000; i++){ repeats.push_back(i / 100); }
+  std::vector<double> reals(20000);
+  for(double& value : reals){ value = double(random()) / 1000.0; }
+  std::sort(reals.begin(), reals.end());
+
+  if(adaptive::searcher<long>(uniform.data(), uniform.size()).uses() != adaptive::searcher<long>::strategy::interpolation){ return false; }
+  if(adaptive::searcher<long>(skewed.data(), skewed.size()).uses() != adaptive::searcher<long>::strategy::bisection){ return false; }
+  for(const std::vector<long>* values : {&uniform, &skewed, &repeats, &one, &none}){
+    if(!functions_match(*values, probes(*values, random))){ return false; }
+  }
+  long small[] = {2, 3, 5, 7, 11, 13};
+  return functions_match(reals, probes(reals, random))
+      && adaptive::interpolation_search(small, 7L) == 3 && adaptive::exponential_search(small, 8L) == size_t(-1)
+      && adaptive::searcher<long>(small).search(13) == 5;
+}
+
+bool strings_match(void){
+  std::vector<std::string> values, keys;
+  for(int i = 0; i < 3000; i++){ values.push_back("key" + std::to_string(100000 + i * 3)); } //=> same width, so string order is number order
+  for(int i = -3; i < 9010; i += 2){ keys.push_back("key" + std::to_string(100000 + i)); }
+  keys.push_back("a");
+  keys.push_back("z");
+  return adaptive::searcher<std::string>(values.data(), values.size()).uses() == adaptive::searcher<std::string>::strategy::bisection
+      && searcher_matches(values, keys);
+}
+
+int main(void){
+  int failed = 0;
+  auto check = [&failed](const char* name, bool passed){
+    fmt::print("{:>48} | {}\n", name, passed ? "ok" : "FAILED");
+    failed += !passed;
+  };
+  check("adaptive searches == std::lower_bound (numbers)", numbers_match());
+  check("adaptive::searcher == std::lower_bound (strings)", strings_match());
+  return failed ? 1 : 0;
+}
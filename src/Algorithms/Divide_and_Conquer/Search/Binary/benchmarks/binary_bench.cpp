@@ -0,0 +1,66 @@
+/* >=====> Binary Search Benchmark <=====< */
+//=> Sweeps sorted arrays from 1K elements up to 2^max elements (argv[1], default 26, up to 32 = 4G
+//=> elements = 16GB of uint32) and reports the average time per random lookup.
+//=> Build with: cmake -S . -B build -DCMAKE_BUILD_TYPE=Release -DBUILD_BENCHMARKS=ON
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <fmt/core.h>
+#include <binary.hpp>
+#include <eytzinger.hpp>
+#include <splus_tree.hpp>
+
+using element = std::uint32_t;
+
+template<class Search>
+double measure(const std::unique_ptr<element[]>& queries, size_t Q, Search search, size_t& checksum){
+  auto start = std::chrono::steady_clock::now();
+  for(size_t q = 0; q < Q; q++){ checksum += search(queries[q]); }
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(stop - start).count() / Q;
+}
+
+template<class Batch>
+double measure_batch(size_t Q, Batch batch, const std::unique_ptr<size_t[]>& results, size_t& checksum){
+  auto start = std::chrono::steady_clock::now();
+  batch();
+  auto stop = std::chrono::steady_clock::now();
+  for(size_t q = 0; q < Q; q++){ checksum += results[q]; }
+  return std::chrono::duration<double, std::nano>(stop - start).count() / Q;
+}
+
+int main(int argc, char** argv){
+  size_t max_log = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 26;
+  if(max_log > 32){ max_log = 32; }
+  constexpr size_t Q = 1 << 20; //=> lookups per size
+
+  std::mt19937_64 random(42);
+  auto queries = std::make_unique<element[]>(Q);
+  auto results = std::make_unique<size_t[]>(Q);
+
+  fmt::print("{:>12} | {:>16} | {:>16} | {:>16} | {:>16} | {:>16} | {:>16} | {:>16}\n", "elements", "std::lower_bound", "binary::lower", "binary::search", "eytzinger", "s+ tree", "batch", "batch (sorted)");
+  for(size_t log = 10; log <= max_log; log += 2){
+    size_t N = size_t(1) << log;
+    auto arr = std::make_unique<element[]>(N);
+    for(size_t i = 0; i < N; i++){ arr[i] = element(i); }
+    for(size_t q = 0; q < Q; q++){ queries[q] = element(random() % N); }
+
+    size_t checksum = 0;
+    double stl = measure(queries, Q, [&](element key){ return size_t(std::lower_bound(arr.get(), arr.get() + N, key) - arr.get()); }, checksum);
+    double lower = measure(queries, Q, [&](element key){ return binary::lower_bound(arr.get(), key, N); }, checksum);
+    double search = measure(queries, Q, [&](element key){ return binary::binary_search(arr.get(), key, N); }, checksum);
+    binary::static_search_index<element> index(arr.get(), N);
+    double eytzinger = measure(queries, Q, [&](element key){ return index.lower_bound(key); }, checksum);
+    binary::static_bplus_tree<element> tree(arr.get(), N);
+    double splus = measure(queries, Q, [&](element key){ return tree.lower_bound(key); }, checksum);
+    double batch = measure_batch(Q, [&](){ binary::batch_lower_bound(arr.get(), N, queries.get(), Q, results.get()); }, results, checksum);
+    std::sort(queries.get(), queries.get() + Q);
+    double sorted = measure_batch(Q, [&](){ binary::batch_lower_bound(arr.get(), N, queries.get(), Q, results.get()); }, results, checksum);
+
+    fmt::print("{:>12} | {:>13.1f} ns | {:>13.1f} ns | {:>13.1f} ns | {:>13.1f} ns | {:>13.1f} ns | {:>13.1f} ns | {:>13.1f} ns   (checksum {})\n", N, stl, lower, search, eytzinger, splus, batch, sorted, checksum);
+  }
+  return 0;
+}
@@ -1,38 +1,18 @@
 /* >=====> 1. Binary Search Algorithm based on Divide & Conquer Algorithms <=====< */
 
 /* >-----> 1-1. Non-Rcursive Binary Search <-----< */
-template<class T, size_t N> //=> Worst = Average = O(log n), Best = O(1), Space Complexity = O(1)
+//=> Both overloads route to the branchless lower_bound (1-3), which neither overflows on
+//=> (low + high) nor underflows on N - 1 when the array is empty.
+template<class T, size_t N> //=> Worst = Average = Best = O(log n), Space Complexity = O(1)
 size_t binary_search(T (&arr)[N], T key){ //=> (&arr)[N] is an array reference, not a pointer.
-  size_t low = 0, high = N - 1;
-
-  while(low <= high){
-    size_t mid = (low + high)/2;
-
-    if(arr[mid] == key){ return mid; }
-
-    else if(arr[mid] < key){ low = mid + 1; }
-
-    else { high = mid - 1; }
-  }
-
-  return -1;
+  size_t index = lower_bound(arr, key, N);
+  return (index < N && arr[index] == key) ? index : -1;
 }
 
-template<class T> //=> Worst = Average = O(log n), Best = O(1), Space Complexity = O(1)
+template<class T> //=> Worst = Average = Best = O(log n), Space Complexity = O(1)
 size_t binary_search(T* arr, T key, size_t N){ //=> This Overloaded Version is for manual size evaluation.
-  size_t low = 0, high = N - 1;
-
-  while(low <= high){
-    size_t mid = (low + high)/2;
-
-    if(arr[mid] == key){ return mid; }
-
-    else if(arr[mid] < key){ low = mid + 1; }
-
-    else { high = mid - 1; }
-  }
-
-  return -1;
+  size_t index = lower_bound(arr, key, N);
+  return (index < N && arr[index] == key) ? index : -1;
 }
 
 
@@ -40,7 +20,7 @@ size_t binary_search(T* arr, T key, size_t N){ //=> This Overloaded Version is f
 template<class T> //=> Recursive Binary Search Algorithm Function
 size_t rec_binary_search_algo(T* arr, T key, size_t low, size_t high){
   if(low <= high ){
-    size_t mid = (low + high)/2;
+    size_t mid = low + (high - low)/2; //=> (low + high) could overflow
 
     if(arr[mid] == key){ return mid; }
 
@@ -48,7 +28,7 @@ size_t rec_binary_search_algo(T* arr, T key, size_t low, size_t high){
       return rec_binary_search_algo(arr, key, mid + 1, high);
     }
 
-    else {
+    else if(mid > low) { //=> mid - 1 would underflow below index 0
       return rec_binary_search_algo(arr, key, low, mid - 1);
     }
   }
@@ -57,10 +37,129 @@ size_t rec_binary_search_algo(T* arr, T key, size_t low, size_t high){
 
 template<class T, size_t N> //=> A Wrapper Function For Better Experience.
 size_t rec_binary_search(T (&arr)[N], T key){ //=> Worst = Average = O(log n), Best = O(1), Space Complexity = O(1)
+  if(N == 0){ return -1; }
   return rec_binary_search_algo(arr, key, 0, N - 1);
 }
 
 template<class T> //=> A Wrapper Function For Better Experience.
 size_t rec_binary_search(T* arr, T key, size_t N){ //=> This Overloaded Version is for manual size evaluation.
+  if(N == 0){ return -1; }
   return rec_binary_search_algo(arr, key, 0, N - 1);
 }
+
+
+/* >-----> 1-3. Branchless Bounds <-----< */
+//=> Instead of a three-way branch that mispredicts about half the time, the search keeps a base
+//=> pointer and a shrinking length: every step compares once and picks the next base with a
+//=> conditional move, so the loop runs exactly ceil(log2 n) times with no data-dependent branch.
+//=> On arrays that do not fit in cache both candidates for the next midpoint are prefetched,
+//=> which overlaps the next cache miss with the current one.
+template<class T> //=> Worst = Average = Best = O(log n), Space Complexity = O(1)
+size_t lower_bound(const T* arr, T key, size_t N){
+  if(N == 0){ return 0; }
+  const T* base = arr;
+  size_t length = N;
+
+  if(N >= PREFETCH_MIN){
+    while(length > 1){
+      size_t half = length / 2;
+      prefetch(base + (length - half) / 2); //=> the next midpoint if base stays
+      prefetch(base + half + (length - half) / 2); //=> the next midpoint if base moves
+      base = (base[half] < key) ? base + half : base;
+      length -= half;
+    }
+  }
+  else {
+    while(length > 1){
+      size_t half = length / 2;
+      base = (base[half] < key) ? base + half : base;
+      length -= half;
+    }
+  }
+  return (base - arr) + (*base < key);
+}
+
+template<class T, size_t N> //=> Worst = Average = Best = O(log n), Space Complexity = O(1)
+size_t lower_bound(T (&arr)[N], T key){ //=> (&arr)[N] is an array reference, not a pointer.
+  return lower_bound(static_cast<const T*>(arr), key, N);
+}
+
+template<class T> //=> Worst = Average = Best = O(log n), Space Complexity = O(1)
+size_t upper_bound(const T* arr, T key, size_t N){
+  if(N == 0){ return 0; }
+  const T* base = arr;
+  size_t length = N;
+
+  if(N >= PREFETCH_MIN){
+    while(length > 1){
+      size_t half = length / 2;
+      prefetch(base + (length - half) / 2);
+      prefetch(base + half + (length - half) / 2);
+      base = (key < base[half]) ? base : base + half;
+      length -= half;
+    }
+  }
+  else {
+    while(length > 1){
+      size_t half = length / 2;
+      base = (key < base[half]) ? base : base + half;
+      length -= half;
+    }
+  }
+  return (base - arr) + !(key < *base);
+}
+
+template<class T, size_t N> //=> Worst = Average = Best = O(log n), Space Complexity = O(1)
+size_t upper_bound(T (&arr)[N], T key){ //=> (&arr)[N] is an array reference, not a pointer.
+  return upper_bound(static_cast<const T*>(arr), key, N);
+}
+
+
+/* >-----> 1-4. Batched Bounds <-----< */
+//=> Independent lookups against the same array each wait on their own cache misses. Because the
+//=> branchless search shrinks the length the same way for every key, BATCH_GROUP searches can
+//=> share one loop: each step updates every lane and prefetches that lane's next probe, so the
+//=> group keeps BATCH_GROUP misses in flight instead of one.
+//=> Sorted queries skip all that: their answers are non-decreasing, so a single merge-like pass
+//=> gallops forward from the previous answer, which is O(log gap) per query instead of O(log n).
+template<class T> //=> O(q log n) interleaved, O(q log(n / q)) when the queries are sorted, Space Complexity = O(1)
+void batch_lower_bound(const T* sorted, size_t N, const T* queries, size_t Q, size_t* out){
+  if(std::is_sorted(queries, queries + Q)){
+    size_t position = 0;
+    for(size_t q = 0; q < Q; q++){
+      size_t bound = 1; //=> gallop: sorted[position + bound / 2 - 1] < key once bound >= 2
+      while(position + bound <= N && sorted[position + bound - 1] < queries[q]){ bound *= 2; }
+      size_t low = position + bound / 2, high = (position + bound < N) ? position + bound : N;
+      position = low + lower_bound(sorted + low, queries[q], high - low);
+      out[q] = position;
+    }
+    return;
+  }
+
+  if(N == 0){
+    for(size_t q = 0; q < Q; q++){ out[q] = 0; }
+    return;
+  }
+
+  const T* base[BATCH_GROUP];
+  for(size_t first = 0; first < Q; first += BATCH_GROUP){
+    size_t lanes = (Q - first < BATCH_GROUP) ? Q - first : BATCH_GROUP;
+    const T* key = queries + first;
+    for(size_t g = 0; g < lanes; g++){ base[g] = sorted; }
+
+    for(size_t length = N; length > 1; ){
+      size_t half = length / 2, next = (length - half) / 2;
+      for(size_t g = 0; g < lanes; g++){
+        base[g] = (base[g][half] < key[g]) ? base[g] + half : base[g];
+        prefetch(base[g] + next); //=> the probe this lane makes on the next step
+      }
+      length -= half;
+    }
+    for(size_t g = 0; g < lanes; g++){ out[first + g] = (base[g] - sorted) + (*base[g] < key[g]); }
+  }
+}
+
+template<class T, size_t N, size_t Q> //=> O(q log n) interleaved, O(q log(n / q)) when the queries are sorted, Space Complexity = O(1)
+void batch_lower_bound(T (&sorted)[N], const T (&queries)[Q], size_t (&out)[Q]){ //=> (&arr)[N] is an array reference, not a pointer.
+  batch_lower_bound(static_cast<const T*>(sorted), N, static_cast<const T*>(queries), Q, static_cast<size_t*>(out));
+}
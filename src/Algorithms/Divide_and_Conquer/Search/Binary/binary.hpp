@@ -2,15 +2,29 @@
 #define BINARY_HPP
 
 #include <cstddef> //=> for size_t
+#include <algorithm> //=> for std::is_sorted
 
 namespace binary{
+  //=> Some Constants
+  constexpr size_t PREFETCH_MIN = 1 << 14; //=> below this many elements (64KB of int) the array is cache resident
+  constexpr size_t BATCH_GROUP = 16; //=> searches advanced in lockstep by batch_lower_bound
+
+  //=> A Portable Software Prefetch (a no-op where the compiler has no builtin for it)
+  inline void prefetch(const void* address) noexcept {
+  #if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+  #else
+    (void)address;
+  #endif
+  }
+
   /* >=====> 1. Binary Search Algorithm based on Divide & Conquer Algorithms <=====< */
 
   /* >-----> 1-1. Non-Rcursive Binary Search <-----< */
-  template<class T, size_t N> //=> Worst = Average = O(log n), Best = O(1), Space Complexity = O(1)
+  template<class T, size_t N> //=> Worst = Average = Best = O(log n), Space Complexity = O(1)
   size_t binary_search(T (&arr)[N], T key); //=> (&arr)[N] is an array reference, not a pointer.
 
-  template<class T> //=> Worst = Average = O(log n), Best = O(1), Space Complexity = O(1)
+  template<class T> //=> Worst = Average = Best = O(log n), Space Complexity = O(1)
   size_t binary_search(T* arr, T key, size_t N); //=> This Overloaded Version is for manual size evaluation.
 
   /* >-----> 1-2. Recursive Binary Search <-----< */
@@ -23,6 +37,26 @@ namespace binary{
   template<class T> //=> A Wrapper Function For Better Experience.
   size_t rec_binary_search(T* arr, T key, size_t N); //=> This Overloaded Version is for manual size evaluation.
 
+  /* >-----> 1-3. Branchless Bounds <-----< */
+  template<class T> //=> Worst = Average = Best = O(log n), Space Complexity = O(1)
+  size_t lower_bound(const T* arr, T key, size_t N); //=> index of the first element >= key, N if there is none.
+
+  template<class T, size_t N> //=> Worst = Average = Best = O(log n), Space Complexity = O(1)
+  size_t lower_bound(T (&arr)[N], T key); //=> (&arr)[N] is an array reference, not a pointer.
+
+  template<class T> //=> Worst = Average = Best = O(log n), Space Complexity = O(1)
+  size_t upper_bound(const T* arr, T key, size_t N); //=> index of the first element > key, N if there is none.
+
+  template<class T, size_t N> //=> Worst = Average = Best = O(log n), Space Complexity = O(1)
+  size_t upper_bound(T (&arr)[N], T key); //=> (&arr)[N] is an array reference, not a pointer.
+
+  /* >-----> 1-4. Batched Bounds <-----< */
+  template<class T> //=> O(q log n) interleaved, O(q log(n / q)) when the queries are sorted, Space Complexity = O(1)
+  void batch_lower_bound(const T* sorted, size_t N, const T* queries, size_t Q, size_t* out); //=> out[i] = lower_bound(queries[i])
+
+  template<class T, size_t N, size_t Q> //=> O(q log n) interleaved, O(q log(n / q)) when the queries are sorted, Space Complexity = O(1)
+  void batch_lower_bound(T (&sorted)[N], const T (&queries)[Q], size_t (&out)[Q]); //=> (&arr)[N] is an array reference, not a pointer.
+
 
   #include "binary.cpp" //=> the implementaion file
 }
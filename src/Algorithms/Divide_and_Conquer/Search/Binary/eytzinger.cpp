@@ -0,0 +1,95 @@
+/* >=====> 2. Eytzinger-Layout Static Search Index <=====< */
+
+/* >-----> 2-1. Rank Mapping <-----< */
+//=> The Eytzinger tree of N nodes is a complete tree of H levels whose last level holds its M
+//=> nodes on the left. In a perfect tree, node k at depth d (its i-th node) has the in-order
+//=> position p = (2i + 1) * 2^(H - 1 - d) - 1, and the last-level leaves sit on the even
+//=> positions. Every missing leaf in front of p shifts the rank down by one.
+template<class T>
+size_t static_search_index<T>::rank(size_t k) const noexcept {
+  size_t H = std::bit_width(N), d = std::bit_width(k) - 1;
+  size_t i = k - (size_t(1) << d);
+  size_t p = ((2 * i + 1) << (H - 1 - d)) - 1;
+  size_t M = N - ((size_t(1) << (H - 1)) - 1); //=> nodes on the last level
+  size_t before = (p + 1) / 2; //=> leaf positions in front of p
+  return (before > M) ? p - (before - M) : p;
+}
+
+/* >-----> 2-2. Building <-----< */
+template<class T> //=> Time = O(n), Space Complexity = O(n)
+static_search_index<T>::static_search_index(const T* sorted, size_t N) : tree(nullptr), N(N) {
+  T* block = static_cast<T*>(::operator new[]((N + 1) * sizeof(T), std::align_val_t{ALIGNMENT}));
+  size_t built = 0; //=> a throwing T destroys what was built and frees the block, the destructor never runs
+  try {
+    std::uninitialized_value_construct_n(block, 1); //=> the padding slot
+    for(built = 1; built <= N; built++){ ::new (static_cast<void*>(block + built)) T(sorted[rank(built)]); }
+  }
+  catch(...) {
+    std::destroy_n(block, built);
+    ::operator delete[](block, std::align_val_t{ALIGNMENT});
+    throw;
+  }
+  tree = block;
+}
+
+template<class T>
+static_search_index<T>& static_search_index<T>::operator=(static_search_index&& other) noexcept {
+  if(this != &other){
+    this->~static_search_index();
+    tree = std::exchange(other.tree, nullptr);
+    N = std::exchange(other.N, 0);
+  }
+  return *this;
+}
+
+template<class T>
+static_search_index<T>::~static_search_index(){
+  if(tree == nullptr){ return; }
+  std::destroy_n(tree, N + 1);
+  ::operator delete[](tree, std::align_val_t{ALIGNMENT});
+}
+
+/* >-----> 2-3. Searching <-----< */
+//=> The descent is branchless: k = 2k + (tree[k] < key). Once k runs off the tree, the trailing
+//=> one bits of k are the right turns taken after the last left turn, and shifting them (plus
+//=> that left turn) away leaves the node holding the answer, or 0 when there is none.
+template<class T>
+size_t static_search_index<T>::descend(const T& key, bool upper) const noexcept {
+  size_t k = 1;
+  while(k <= N){
+    for(size_t line = 0; line < LOOKAHEAD * sizeof(T); line += ALIGNMENT){ //=> one line for 4-byte keys
+      prefetch(reinterpret_cast<const char*>(tree + k * LOOKAHEAD) + line);
+    }
+    k = 2 * k + (upper ? !(key < tree[k]) : (tree[k] < key));
+  }
+  return k >> (std::countr_one(k) + 1);
+}
+
+template<class T> //=> Worst = Average = Best = O(log n), Space Complexity = O(1)
+size_t static_search_index<T>::lower_bound(const T& key) const noexcept {
+  size_t k = descend(key, false);
+  return k ? rank(k) : N;
+}
+
+template<class T> //=> Worst = Average = Best = O(log n), Space Complexity = O(1)
+size_t static_search_index<T>::upper_bound(const T& key) const noexcept {
+  size_t k = descend(key, true);
+  return k ? rank(k) : N;
+}
+
+template<class T> //=> Worst = Average = Best = O(log n), Space Complexity = O(1)
+size_t static_search_index<T>::search(const T& key) const noexcept {
+  size_t k = descend(key, false);
+  return (k && !(key < tree[k])) ? rank(k) : -1;
+}
+
+/* >-----> 2-4. Accessing <-----< */
+//=> Walks down like a search would, comparing ranks instead of keys.
+template<class T>
+const T& static_search_index<T>::operator[](size_t target) const noexcept {
+  size_t k = 1;
+  for(size_t current = rank(k); current != target; current = rank(k)){
+    k = 2 * k + (current < target);
+  }
+  return tree[k];
+}
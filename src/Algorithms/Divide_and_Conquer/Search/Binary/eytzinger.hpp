@@ -0,0 +1,59 @@
+#ifndef EYTZINGER_HPP
+#define EYTZINGER_HPP
+
+#include <cstddef> //=> for size_t
+#include <new> //=> for the aligned operator new
+#include <memory> //=> for uninitialized copies
+#include <bit> //=> for std::bit_width & std::countr_one
+#include <utility> //=> for std::exchange
+#include "binary.hpp" //=> for binary::prefetch
+
+namespace binary{
+  /* >=====> 2. Eytzinger-Layout Static Search Index <=====< */
+  //=> A read-only index built once from a sorted array. The keys are stored in Eytzinger (BFS)
+  //=> order: node k has its children at 2k and 2k + 1, so the top levels of every search share the
+  //=> same few cache lines and the 16 descendants four levels down are one aligned 64-byte line
+  //=> (for 4-byte keys) that can be prefetched before it is needed.
+  //=> Lookups return the rank of the key in the original sorted array, not its Eytzinger slot.
+  template<class T>
+  class static_search_index {
+    private:
+      static constexpr size_t ALIGNMENT = 64; //=> one cache line
+      static constexpr size_t LOOKAHEAD = 16; //=> 2^4, prefetch four levels ahead
+
+      T* tree; //=> 1-based Eytzinger array, tree[0] is unused padding
+      size_t N; //=> number of keys
+
+      size_t rank(size_t k) const noexcept; //=> Eytzinger slot => index in the sorted array, O(1)
+      size_t descend(const T& key, bool upper) const noexcept; //=> the shared search loop, returns an Eytzinger slot
+
+    public:
+      /*assigning*/
+      static_search_index(const T* sorted, size_t N); //=> O(n) build from a sorted buffer
+      template<size_t S>
+      static_search_index(T (&sorted)[S]) : static_search_index(static_cast<const T*>(sorted), S) {} //=> (&sorted)[S] is an array reference
+
+      static_search_index(const static_search_index&) = delete;
+      static_search_index& operator=(const static_search_index&) = delete;
+      static_search_index(static_search_index&& other) noexcept : tree(std::exchange(other.tree, nullptr)), N(std::exchange(other.N, 0)) {}
+      static_search_index& operator=(static_search_index&& other) noexcept;
+      ~static_search_index();
+
+      //searching || Worst = Average = Best = O(log n), about one cache miss per four levels
+      size_t lower_bound(const T& key) const noexcept; //=> rank of the first key >= key, size() if there is none
+      size_t upper_bound(const T& key) const noexcept; //=> rank of the first key > key, size() if there is none
+      size_t search(const T& key) const noexcept; //=> rank of key, or -1 like binary::binary_search
+      bool contains(const T& key) const noexcept { return search(key) != size_t(-1); }
+
+      //accessing
+      const T& operator[](size_t rank) const noexcept; //=> the key with that rank, O(log n)
+
+      //size and capacity
+      size_t size(void) const noexcept { return N; }
+      bool empty(void) const noexcept { return N == 0; }
+  };
+
+  #include "eytzinger.cpp" //=> the implementaion file
+}
+
+#endif
@@ -0,0 +1,130 @@
+/* >=====> 3. Static B+ Tree (S+ Tree) <=====< */
+
+/* >-----> 3-1. Node Rank <-----< */
+template<class T>
+size_t static_bplus_tree<T>::node_rank(const T* node, const T& key) noexcept {
+#if defined(__AVX2__)
+  if constexpr (std::is_same_v<T, std::int32_t> || std::is_same_v<T, std::uint32_t>){
+    //=> AVX2 only compares signed lanes, flipping the sign bit orders unsigned keys the same way
+    __m256i flip = _mm256_set1_epi32(std::is_signed_v<T> ? 0 : INT32_MIN);
+    __m256i x = _mm256_xor_si256(_mm256_set1_epi32(std::int32_t(key)), flip);
+    __m256i low = _mm256_cmpgt_epi32(x, _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(node)), flip));
+    __m256i high = _mm256_cmpgt_epi32(x, _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(node + 8)), flip));
+    unsigned mask = unsigned(_mm256_movemask_ps(_mm256_castsi256_ps(low)))
+                  | unsigned(_mm256_movemask_ps(_mm256_castsi256_ps(high))) << 8;
+    return std::popcount(mask);
+  }
+  else if constexpr (std::is_same_v<T, float>){
+    __m256 x = _mm256_set1_ps(key);
+    unsigned mask = unsigned(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(node), x, _CMP_LT_OQ)))
+                  | unsigned(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(node + 8), x, _CMP_LT_OQ))) << 8;
+    return std::popcount(mask);
+  }
+  else
+#endif
+  {
+    size_t rank = 0;
+    for(size_t j = 0; j < B; j++){ rank += (node[j] < key); } //=> no early exit, so it vectorizes
+    return rank;
+  }
+}
+
+template<class T>
+size_t static_bplus_tree<T>::leaf_rank(size_t leaf, const T& key) const noexcept {
+  size_t first = leaf * B;
+  if(first + B <= N){ return node_rank(leaves + first, key); }
+  size_t rank = 0; //=> the last leaf is partial, never read past the caller's buffer
+  for(size_t i = first; i < N; i++){ rank += (leaves[i] < key); }
+  return rank;
+}
+
+/* >-----> 3-2. Building <-----< */
+//=> Layer h + 1 has ceil(nodes_h / 17) nodes, up to a single root. Key j of node n on layer h is
+//=> the smallest key under child j + 1, i.e. the first key of that child's leftmost leaf; children
+//=> past the end get the padding key, which no search ever counts as smaller.
+template<class T> //=> Time = O(n / B), Space Complexity = O(n / B)
+static_bplus_tree<T>::static_bplus_tree(const T* sorted, size_t N) : leaves(sorted), N(N), nodes(nullptr) {
+  std::vector<size_t> layer_nodes{(N + B - 1) / B}; //=> layer 0 = the leaves
+  while(layer_nodes.back() > 1){ layer_nodes.push_back((layer_nodes.back() + B) / (B + 1)); }
+
+  widths = layer_nodes;
+  offsets.assign(layer_nodes.size(), 0);
+  size_t total = 0;
+  for(size_t h = 1; h < layer_nodes.size(); h++){ offsets[h] = total; total += layer_nodes[h] * B; }
+  if(total == 0){ return; }
+
+  nodes = static_cast<T*>(::operator new[](total * sizeof(T), std::align_val_t{ALIGNMENT}));
+  const T& padding = sorted[N - 1]; //=> never smaller than a real key of the same node
+  size_t span = 1; //=> leaves under one child of a layer h node
+  for(size_t h = 1; h < layer_nodes.size(); h++, span *= B + 1){
+    for(size_t n = 0; n < layer_nodes[h]; n++){
+      for(size_t j = 0; j < B; j++){
+        size_t first = (n * (B + 1) + j + 1) * span * B;
+        ::new (static_cast<void*>(nodes + offsets[h] + n * B + j)) T(first < N ? sorted[first] : padding);
+      }
+    }
+  }
+}
+
+template<class T>
+static_bplus_tree<T>::static_bplus_tree(static_bplus_tree&& other) noexcept
+  : leaves(std::exchange(other.leaves, nullptr)), N(std::exchange(other.N, 0)),
+    nodes(std::exchange(other.nodes, nullptr)), offsets(std::move(other.offsets)), widths(std::move(other.widths)) {}
+
+template<class T>
+static_bplus_tree<T>& static_bplus_tree<T>::operator=(static_bplus_tree&& other) noexcept {
+  if(this != &other){
+    this->~static_bplus_tree();
+    leaves = std::exchange(other.leaves, nullptr);
+    N = std::exchange(other.N, 0);
+    nodes = std::exchange(other.nodes, nullptr);
+    offsets = std::move(other.offsets);
+    widths = std::move(other.widths);
+  }
+  return *this;
+}
+
+template<class T>
+static_bplus_tree<T>::~static_bplus_tree(){
+  if(nodes == nullptr){ return; }
+  size_t total = offsets.back() + B; //=> the root layer is a single node
+  std::destroy_n(nodes, total);
+  ::operator delete[](nodes, std::align_val_t{ALIGNMENT});
+}
+
+/* >-----> 3-3. Searching <-----< */
+template<class T> //=> Worst = Average = Best = O(log_17 n), Space Complexity = O(1)
+size_t static_bplus_tree<T>::lower_bound(const T& key) const noexcept {
+  if(N == 0){ return 0; }
+  size_t n = 0; //=> node index on the current layer
+  for(size_t h = offsets.size() - 1; h > 0; h--){
+    size_t rank = node_rank(nodes + offsets[h] + n * B, key);
+    size_t last = widths[h - 1] - 1 - n * (B + 1); //=> the last real child, B except on the layer's last node
+    n = n * (B + 1) + (rank < last ? rank : last); //=> padding that compared smaller is not counted
+  }
+  return n * B + leaf_rank(n, key); //=> N when every key is smaller
+}
+
+template<class T> //=> Worst = Average = Best = O(log_17 n), Space Complexity = O(1)
+size_t static_bplus_tree<T>::search(const T& key) const noexcept {
+  size_t rank = lower_bound(key);
+  return (rank < N && !(key < leaves[rank])) ? rank : -1;
+}
+
+/* >-----> 3-4. Range Scans <-----< */
+template<class T> //=> O(log_17 n)
+size_t static_bplus_tree<T>::count(const T& low, const T& high) const noexcept {
+  if(!(low < high)){ return 0; }
+  return lower_bound(high) - lower_bound(low);
+}
+
+template<class T>
+template<class F> //=> O(log_17 n + k), the leaves are walked sequentially
+size_t static_bplus_tree<T>::for_each(const T& low, const T& high, F f) const {
+  size_t first = lower_bound(low), i = first;
+  for(; i < N && leaves[i] < high; i++){
+    if((i & (B - 1)) == 0){ prefetch(leaves + i + 4 * B); } //=> stay a few leaves ahead
+    f(leaves[i]);
+  }
+  return i - first;
+}
@@ -0,0 +1,80 @@
+#ifndef SPLUS_TREE_HPP
+#define SPLUS_TREE_HPP
+
+#include <cstddef> //=> for size_t
+#include <cstdint> //=> for std::int32_t & std::uint32_t
+#include <new> //=> for the aligned operator new
+#include <memory> //=> for std::destroy_n
+#include <vector> //=> for the layer offsets
+#include <bit> //=> for std::popcount
+#include <type_traits> //=> for the SIMD dispatch
+#include <utility> //=> for std::exchange
+#if defined(__AVX2__)
+  #include <immintrin.h>
+#endif
+#include <DS/array/array.hpp> //=> for DSA::array
+#include "binary.hpp" //=> for binary::prefetch
+
+namespace binary{
+  /* >=====> 3. Static B+ Tree (S+ Tree) <=====< */
+  //=> A pointer-free static B+ tree over a sorted buffer. Every node is B = 16 keys (one cache line
+  //=> of int), so a lookup costs one cache line per level and log17(n) levels in total, against the
+  //=> log2(n) - 4 misses of an Eytzinger search.
+  //=> The leaf level IS the sorted buffer: the tree is built in place on top of it and only owns
+  //=> the internal layers, about n / 16 keys. The buffer must outlive the tree and not change.
+  //=> Inside a node the rank is one AVX2 compare per 8 keys plus a popcount of the movemask
+  //=> (for 32-bit integer and float keys when compiled with AVX2), or a branch-free counting loop.
+  //=> Only the last node of a layer has unused slots. They repeat the largest key and the rank is capped
+  //=> by the node's real child count, so any T with operator< works (no sentinel such as max() is needed,
+  //=> which strings lack and which +inf would sort past).
+  template<class T>
+  class static_bplus_tree {
+    public:
+      static constexpr size_t B = 16; //=> keys per node
+    private:
+      static constexpr size_t ALIGNMENT = 64; //=> one cache line
+
+      const T* leaves; //=> the caller's sorted buffer (layer 0)
+      size_t N; //=> number of keys
+      T* nodes; //=> the internal layers, the root layer last
+      std::vector<size_t> offsets; //=> offsets[h] = first key of layer h in nodes (h >= 1)
+      std::vector<size_t> widths; //=> widths[h] = nodes on layer h, widths[0] = leaves
+
+      static size_t node_rank(const T* node, const T& key) noexcept; //=> number of keys in a full node < key
+      size_t leaf_rank(size_t leaf, const T& key) const noexcept; //=> same, bounded by N on the last leaf
+
+    public:
+      /*assigning*/
+      static_bplus_tree(const T* sorted, size_t N); //=> O(n / B) build over a sorted buffer
+      template<size_t S, size_t A>
+      static_bplus_tree(const DSA::array<T, S, A>& sorted) : static_bplus_tree(sorted.data(), S) {}
+      template<size_t S>
+      static_bplus_tree(const T (&sorted)[S]) : static_bplus_tree(static_cast<const T*>(sorted), S) {} //=> (&sorted)[S] is an array reference
+
+      static_bplus_tree(const static_bplus_tree&) = delete;
+      static_bplus_tree& operator=(const static_bplus_tree&) = delete;
+      static_bplus_tree(static_bplus_tree&& other) noexcept;
+      static_bplus_tree& operator=(static_bplus_tree&& other) noexcept;
+      ~static_bplus_tree();
+
+      //searching || Worst = Average = Best = O(log_17 n) cache lines
+      size_t lower_bound(const T& key) const noexcept; //=> rank of the first key >= key, size() if there is none
+      size_t search(const T& key) const noexcept; //=> rank of key, or -1 like binary::binary_search
+      bool contains(const T& key) const noexcept { return search(key) != size_t(-1); }
+
+      //range scans over the leaf level || O(log_17 n + k)
+      size_t count(const T& low, const T& high) const noexcept; //=> keys in [low, high)
+      template<class F>
+      size_t for_each(const T& low, const T& high, F f) const; //=> calls f(key) on the keys in [low, high), returns how many
+
+      //size and capacity
+      size_t size(void) const noexcept { return N; }
+      bool empty(void) const noexcept { return N == 0; }
+      size_t height(void) const noexcept { return offsets.size(); } //=> levels including the leaves
+      const T* data(void) const noexcept { return leaves; }
+  };
+
+  #include "splus_tree.cpp" //=> the implementaion file
+}
+
+#endif
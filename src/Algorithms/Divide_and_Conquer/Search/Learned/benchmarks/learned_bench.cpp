@@ -0,0 +1,51 @@
+/* >=====> Learned Index Benchmark <=====< */
+//=> Nearly linear keys (i * 16 plus noise) from 1K up to 2^max elements (argv[1], default 26):
+//=> average time per random lookup for binary::lower_bound, the Eytzinger index and the PGM index,
+//=> plus the size of the PGM index next to the size of the data.
+//=> Build with: cmake -S . -B build -DCMAKE_BUILD_TYPE=Release -DBUILD_BENCHMARKS=ON
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <fmt/core.h>
+#include <binary.hpp>
+#include <eytzinger.hpp>
+#include <Algorithms/Divide_and_Conquer/Search/Learned/learned.hpp>
+
+using element = std::uint64_t;
+
+template<class Search>
+double measure(const std::unique_ptr<element[]>& queries, size_t Q, Search search, size_t& checksum){
+  auto start = std::chrono::steady_clock::now();
+  for(size_t q = 0; q < Q; q++){ checksum += search(queries[q]); }
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(stop - start).count() / Q;
+}
+
+int main(int argc, char** argv){
+  size_t max_log = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 26;
+  constexpr size_t Q = 1 << 20; //=> lookups per size
+
+  std::mt19937_64 random(42);
+  auto queries = std::make_unique<element[]>(Q);
+
+  fmt::print("{:>12} | {:>14} | {:>14} | {:>14} | {:>10} | {:>12}\n", "elements", "binary::lower", "eytzinger", "pgm<64>", "segments", "pgm / data");
+  for(size_t log = 10; log <= max_log; log += 2){
+    size_t N = size_t(1) << log;
+    auto arr = std::make_unique<element[]>(N);
+    for(size_t i = 0; i < N; i++){ arr[i] = element(i) * 16 + random() % 16; }
+    for(size_t q = 0; q < Q; q++){ queries[q] = random() % (N * 16); }
+
+    size_t checksum = 0;
+    double lower = measure(queries, Q, [&](element key){ return binary::lower_bound(arr.get(), key, N); }, checksum);
+    binary::static_search_index<element> index(arr.get(), N);
+    double eytzinger = measure(queries, Q, [&](element key){ return index.lower_bound(key); }, checksum);
+    learned::pgm_index<element, 64> pgm(arr.get(), N);
+    double learned = measure(queries, Q, [&](element key){ return pgm.lower_bound(key); }, checksum);
+
+    double ratio = 100.0 * pgm.size_in_bytes() / (N * sizeof(element));
+    fmt::print("{:>12} | {:>11.1f} ns | {:>11.1f} ns | {:>11.1f} ns | {:>10} | {:>10.4f} %   (checksum {})\n", N, lower, eytzinger, learned, pgm.segments(), ratio, checksum);
+  }
+  return 0;
+}
@@ -0,0 +1,106 @@
+/* >=====> 1. Piecewise Geometric Model (PGM) Index <=====< */
+
+/* >-----> 1-1. Building <-----< */
+//=> A segment is anchored at its first point (k0, p0). Every later point (k, p) only allows the
+//=> slopes that keep it within Epsilon, [(p - Epsilon - p0) / dk, (p + Epsilon - p0) / dk], and the
+//=> segment keeps the intersection of those intervals. When a point empties the cone, the segment
+//=> is closed with the middle slope and the point starts the next one.
+//=> key_at(i) returns the i-th key, count is how many there are. Repeated keys are fitted only at
+//=> their first rank, which is what lower_bound must land on.
+template<class T, size_t Epsilon>
+template<class Key>
+typename pgm_index<T, Epsilon>::level pgm_index<T, Epsilon>::fit(Key key_at, size_t count){
+  level result;
+  if(count == 0){ return result; }
+
+  double low = 0, high = std::numeric_limits<double>::infinity();
+  T first = key_at(0);
+  size_t anchor = 0;
+  auto close = [&](){
+    double slope = (high == std::numeric_limits<double>::infinity()) ? 0 : (low + high) / 2;
+    result.keys.push_back(first);
+    result.models.push_back({slope, anchor});
+  };
+
+  for(size_t i = 1; i < count; i++){
+    T key = key_at(i);
+    if(key == key_at(i - 1)){ continue; }
+    double dk = double(key) - double(first);
+    double lowest = (double(i) - double(anchor) - double(Epsilon)) / dk;
+    double highest = (double(i) - double(anchor) + double(Epsilon)) / dk;
+    if(lowest > high || highest < low || !(dk > 0)){ //=> !(dk > 0): keys too close for a double
+      close();
+      first = key;
+      anchor = i;
+      low = 0;
+      high = std::numeric_limits<double>::infinity();
+      continue;
+    }
+    if(lowest > low){ low = lowest; }
+    if(highest < high){ high = highest; }
+  }
+  close();
+  return result;
+}
+
+template<class T, size_t Epsilon> //=> Time = O(n), Space Complexity = O(n / Epsilon)
+pgm_index<T, Epsilon>::pgm_index(const T* sorted, size_t N) : data(sorted), N(N) {
+  if(N == 0){ return; }
+  levels.push_back(fit([&](size_t i){ return sorted[i]; }, N));
+  while(levels.back().keys.size() > 1){
+    const std::vector<T>& below = levels.back().keys;
+    levels.push_back(fit([&](size_t i){ return below[i]; }, below.size()));
+  }
+}
+
+template<class T, size_t Epsilon>
+size_t pgm_index<T, Epsilon>::size_in_bytes(void) const noexcept {
+  size_t bytes = sizeof(*this) + levels.capacity() * sizeof(level);
+  for(const level& l : levels){ bytes += l.keys.capacity() * sizeof(T) + l.models.capacity() * sizeof(model); }
+  return bytes;
+}
+
+/* >-----> 1-2. Searching <-----< */
+template<class T, size_t Epsilon>
+size_t pgm_index<T, Epsilon>::predict(const level& l, size_t segment, const T& key, size_t limit) noexcept {
+  const model& m = l.models[segment];
+  double position = double(m.position) + m.slope * (double(key) - double(l.keys[segment]));
+  if(!(position > 0)){ return 0; }
+  return (position < double(limit)) ? size_t(position) : limit;
+}
+
+//=> Each level predicts a position on the level below and settles it with a window search. The
+//=> window is checked against its neighbours; if the answer lies outside (keys past a segment's
+//=> end, or rounding on huge integer keys) the search widens to the rest of the array, so the
+//=> result is always exact and the bound only affects speed.
+template<class T, size_t Epsilon> //=> O(log_Epsilon n) levels, each an O(log Epsilon) window search
+size_t pgm_index<T, Epsilon>::lower_bound(const T& key) const noexcept {
+  if(N == 0){ return 0; }
+
+  auto window = [&](const T* keys, size_t count, size_t guess, bool upper){
+    size_t low = (guess > Epsilon + 1) ? guess - Epsilon - 1 : 0;
+    size_t high = (guess + Epsilon + 2 < count) ? guess + Epsilon + 2 : count;
+    auto bound = [&](size_t from, size_t to){
+      return from + (upper ? binary::upper_bound(keys + from, key, to - from) : binary::lower_bound(keys + from, key, to - from));
+    };
+    size_t rank = bound(low, high);
+    if(rank == low && low > 0 && (upper ? !(key < keys[low - 1]) : !(keys[low - 1] < key))){ rank = bound(0, low); }
+    else if(rank == high && high < count && (upper ? !(key < keys[high]) : keys[high] < key)){ rank = bound(high, count); }
+    return rank;
+  };
+
+  size_t segment = 0; //=> the root level has one segment
+  for(size_t l = levels.size() - 1; l > 0; l--){
+    const std::vector<T>& below = levels[l - 1].keys;
+    size_t guess = predict(levels[l], segment, key, below.size() - 1);
+    size_t rank = window(below.data(), below.size(), guess, true); //=> segments starting at or before key
+    segment = rank ? rank - 1 : 0;
+  }
+  return window(data, N, predict(levels[0], segment, key, N - 1), false);
+}
+
+template<class T, size_t Epsilon> //=> O(log_Epsilon n) levels, each an O(log Epsilon) window search
+size_t pgm_index<T, Epsilon>::search(const T& key) const noexcept {
+  size_t rank = lower_bound(key);
+  return (rank < N && !(key < data[rank])) ? rank : -1;
+}
@@ -0,0 +1,63 @@
+#ifndef LEARNED_HPP
+#define LEARNED_HPP
+
+#include <cstddef> //=> for size_t
+#include <type_traits> //=> for std::is_arithmetic_v
+#include <vector> //=> for the levels
+#include <limits> //=> for the initial slope cone
+#include <Algorithms/Divide_and_Conquer/Search/Binary/binary.hpp> //=> for the last-mile searches
+
+namespace learned{
+  /* >=====> 1. Piecewise Geometric Model (PGM) Index <=====< */
+  //=> A learned index over a sorted numeric buffer. Each segment is a line position = p + slope *
+  //=> (key - k) that predicts the rank of every key it covers to within Epsilon, so a lookup is:
+  //=> pick the segment, predict, and run binary::lower_bound on a window of about 2 * Epsilon keys.
+  //=> The segments are picked the same way one level up, recursively, until a single root segment
+  //=> is left, so the whole index is a few segments per Epsilon keys of data (a 16M key array of
+  //=> near-linear keys needs a handful of segments, a few hundred bytes).
+  //=> Building is one streaming pass per level with a shrinking slope cone (O(1) per key).
+  //=> Like binary::static_bplus_tree, the index sits on top of the caller's buffer, which must
+  //=> outlive it and not change.
+  template<class T, size_t Epsilon = 64>
+  class pgm_index {
+    static_assert(std::is_arithmetic_v<T>, "the models interpolate, so the keys must be numbers");
+    static_assert(Epsilon > 0, "an error bound of 0 would need one segment per key");
+
+    private:
+      struct model { double slope; size_t position; }; //=> the line anchored at the segment's first key
+      struct level {
+        std::vector<T> keys; //=> first key of every segment, increasing
+        std::vector<model> models;
+      };
+
+      const T* data; //=> the caller's sorted buffer
+      size_t N;
+      std::vector<level> levels; //=> levels[0] indexes the data, levels.back() is the root
+
+      template<class Key>
+      static level fit(Key key_at, size_t count); //=> one streaming pass of the shrinking cone
+      static size_t predict(const level& l, size_t segment, const T& key, size_t limit) noexcept;
+
+    public:
+      /*assigning*/
+      pgm_index(const T* sorted, size_t N); //=> O(n) build
+      template<size_t S>
+      pgm_index(const T (&sorted)[S]) : pgm_index(static_cast<const T*>(sorted), S) {} //=> (&sorted)[S] is an array reference
+
+      //searching || O(log_Epsilon n) levels, each an O(log Epsilon) window search
+      size_t lower_bound(const T& key) const noexcept; //=> rank of the first key >= key, size() if there is none
+      size_t search(const T& key) const noexcept; //=> rank of key, or -1 like binary::binary_search
+      bool contains(const T& key) const noexcept { return search(key) != size_t(-1); }
+
+      //size and capacity
+      size_t size(void) const noexcept { return N; }
+      bool empty(void) const noexcept { return N == 0; }
+      size_t segments(void) const noexcept { return levels.empty() ? 0 : levels[0].keys.size(); }
+      size_t height(void) const noexcept { return levels.size(); }
+      size_t size_in_bytes(void) const noexcept; //=> memory held by the index itself, not the data
+  };
+
+  #include "learned.cpp" //=> the implementaion file
+}
+
+#endif
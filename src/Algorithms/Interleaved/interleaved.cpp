@@ -0,0 +1,100 @@
+/* >=====> Coroutine-Based Interleaved Lookups <=====< */
+
+/* >-----> 1. Frame Pool <-----< */
+inline void* frame_pool::allocate(size_t bytes){
+  size_t size_class = (bytes + GRAIN - 1) / GRAIN;
+  if(size_class < CLASSES && lists[size_class] != nullptr){
+    return std::exchange(lists[size_class], lists[size_class]->next);
+  }
+  return ::operator new(size_class * GRAIN);
+}
+
+inline void frame_pool::deallocate(void* frame, size_t bytes) noexcept {
+  size_t size_class = (bytes + GRAIN - 1) / GRAIN;
+  if(size_class >= CLASSES){
+    ::operator delete(frame);
+    return;
+  }
+  lists[size_class] = ::new (frame) block{lists[size_class]};
+}
+
+inline frame_pool::~frame_pool(){
+  for(block*& list : lists){
+    while(list != nullptr){ ::operator delete(std::exchange(list, list->next)); }
+  }
+}
+
+/* >-----> 3. The Lookup Coroutine Type <-----< */
+template<class R>
+R& lookup<R>::result(void){
+  if(handle.promise().error){ std::rethrow_exception(handle.promise().error); }
+  return handle.promise().value;
+}
+
+template<class R>
+R lookup<R>::get(void){
+  while(!handle.done()){ handle.resume(); }
+  return std::move(result());
+}
+
+/* >-----> 4. The Scheduler <-----< */
+template<class Make, class Sink> //=> O(total work), Space Complexity = O(width)
+void schedule(size_t count, Make make, Sink sink, size_t width){
+  using task = std::invoke_result_t<Make&, size_t>;
+  if(width == 0){ width = 1; }
+
+  std::vector<task> slots;
+  std::vector<size_t> ids;
+  size_t next = 0;
+  for(; next < count && next < width; next++){
+    slots.push_back(make(next));
+    ids.push_back(next);
+  }
+
+  for(size_t active = slots.size(); active > 0; ){
+    for(size_t s = 0; s < slots.size(); s++){ //=> one round: every in-flight lookup takes one step
+      if(!slots[s]){ continue; }
+      slots[s].resume();
+      if(!slots[s].done()){ continue; }
+
+      sink(ids[s], slots[s].result());
+      if(next < count){
+        slots[s] = make(next);
+        ids[s] = next++;
+      }
+      else {
+        slots[s] = task();
+        active--;
+      }
+    }
+  }
+}
+
+/* >-----> 5. Coroutine Lookups <-----< */
+//=> The same branchless descent as binary::lower_bound. Once the window is down to one cache line
+//=> it is already loaded, so the last few steps run without suspending.
+template<class T> //=> Worst = Average = Best = O(log n), Space Complexity = O(1) per lookup
+lookup<size_t> binary_search(const T* arr, T key, size_t N){
+  if(N == 0){ co_return size_t(-1); }
+  const T* base = arr;
+  for(size_t length = N; length > 1; ){
+    size_t half = length / 2;
+    if(half * sizeof(T) >= 64){ co_await prefetch(base + half); }
+    base = (base[half] < key) ? base + half : base;
+    length -= half;
+  }
+  size_t index = (base - arr) + (*base < key);
+  co_return (index < N && arr[index] == key) ? index : size_t(-1);
+}
+
+template<class T> //=> Worst = O(h), Space Complexity = O(1) per lookup
+lookup<const Node<T>*> bst_find(const Node<T>* root, T key){
+  for(const Node<T>* node = root; node != nullptr; ){
+    co_await prefetch(node);
+    const T& data = node->getData();
+    if(key == data){ co_return node; }
+    if(key < data){ node = node->hasLeft() ? &node->getLeft() : nullptr; }
+    else { node = node->hasRight() ? &node->getRight() : nullptr; }
+  }
+  co_return nullptr;
+}
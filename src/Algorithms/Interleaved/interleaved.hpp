@@ -0,0 +1,114 @@
+#ifndef INTERLEAVED_HPP
+#define INTERLEAVED_HPP
+
+#include <cstddef> //=> for size_t
+#include <coroutine> //=> for the C++20 coroutine machinery
+#include <exception> //=> for std::exception_ptr
+#include <utility> //=> for std::exchange
+#include <vector> //=> for the scheduler slots
+#include <type_traits> //=> for std::invoke_result_t
+#include <DS/node/node> //=> for Node<T>
+#include <Algorithms/Divide_and_Conquer/Search/Binary/binary.hpp> //=> for binary::prefetch
+
+namespace interleaved{
+  /* >=====> Coroutine-Based Interleaved Lookups <=====< */
+  //=> A lookup that chases pointers spends most of its time waiting on DRAM. Written as a coroutine,
+  //=> it can "co_await prefetch(address)" right before it touches memory: the prefetch is issued, the
+  //=> lookup suspends, and the scheduler resumes the other in-flight lookups in round-robin order.
+  //=> By the time this one is resumed its line has arrived, so WIDTH lookups overlap their misses
+  //=> without a hand-written state machine.
+
+  //=> Some Constants
+  constexpr size_t WIDTH = 16; //=> lookups kept in flight by default
+
+  /* >-----> 1. Frame Pool <-----< */
+  //=> Every lookup is a coroutine frame on the heap. The frames are recycled through per-thread free
+  //=> lists (one per 64-byte size class), so a steady stream of lookups stops calling malloc.
+  class frame_pool {
+    private:
+      static constexpr size_t GRAIN = 64; //=> size class granularity
+      static constexpr size_t CLASSES = 16; //=> frames above 1KB go straight to operator new
+      struct block { block* next; };
+      block* lists[CLASSES] = {};
+
+    public:
+      static frame_pool& local(void) noexcept { thread_local frame_pool pool; return pool; }
+      void* allocate(size_t bytes);
+      void deallocate(void* frame, size_t bytes) noexcept;
+      ~frame_pool();
+  };
+
+  /* >-----> 2. Awaiting A Prefetch <-----< */
+  struct prefetch_awaiter {
+    const void* address;
+    bool await_ready(void) const noexcept { return false; } //=> always give the line time to arrive
+    void await_suspend(std::coroutine_handle<>) const noexcept { binary::prefetch(address); }
+    void await_resume(void) const noexcept {}
+  };
+
+  inline prefetch_awaiter prefetch(const void* address) noexcept { return {address}; } //=> co_await prefetch(p);
+
+  /* >-----> 3. The Lookup Coroutine Type <-----< */
+  //=> lookup<R> is the return type of a lookup coroutine producing an R. It starts suspended and stays
+  //=> suspended at its end, so whoever drives it (the scheduler, or get()) reads the result first.
+  template<class R>
+  class lookup {
+    public:
+      struct promise_type {
+        R value{};
+        std::exception_ptr error;
+
+        lookup get_return_object(void) noexcept { return lookup(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend(void) const noexcept { return {}; }
+        std::suspend_always final_suspend(void) const noexcept { return {}; }
+        void return_value(R result) { value = std::move(result); }
+        void unhandled_exception(void) noexcept { error = std::current_exception(); }
+
+        static void* operator new(size_t bytes) { return frame_pool::local().allocate(bytes); }
+        static void operator delete(void* frame, size_t bytes) noexcept { frame_pool::local().deallocate(frame, bytes); }
+      };
+
+    private:
+      std::coroutine_handle<promise_type> handle;
+      explicit lookup(std::coroutine_handle<promise_type> handle) noexcept : handle(handle) {}
+
+    public:
+      /*assigning*/
+      lookup() noexcept : handle(nullptr) {}
+      lookup(const lookup&) = delete;
+      lookup& operator=(const lookup&) = delete;
+      lookup(lookup&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+      lookup& operator=(lookup&& other) noexcept {
+        if(this != &other){
+          if(handle){ handle.destroy(); }
+          handle = std::exchange(other.handle, nullptr);
+        }
+        return *this;
+      }
+      ~lookup(){ if(handle){ handle.destroy(); } }
+
+      //driving
+      explicit operator bool(void) const noexcept { return handle != nullptr; }
+      bool done(void) const noexcept { return handle.done(); }
+      void resume(void) const { handle.resume(); } //=> runs until the next co_await or the end
+      R& result(void); //=> the co_returned value, rethrows what the lookup threw
+      R get(void); //=> runs the lookup to completion on its own, without overlapping anything
+  };
+
+  /* >-----> 4. The Scheduler <-----< */
+  //=> Runs count lookups, make(i) creating the i-th one, with up to width of them in flight. Each
+  //=> finished lookup is handed to sink(i, result) and its slot is refilled with the next one.
+  template<class Make, class Sink> //=> O(total work), Space Complexity = O(width)
+  void schedule(size_t count, Make make, Sink sink, size_t width = WIDTH);
+
+  /* >-----> 5. Coroutine Lookups <-----< */
+  template<class T> //=> binary::binary_search as a coroutine, suspends before each probe that can miss
+  lookup<size_t> binary_search(const T* arr, T key, size_t N);
+
+  template<class T> //=> BST lookup on Node<T>, suspends before visiting each node, nullptr if absent
+  lookup<const Node<T>*> bst_find(const Node<T>* root, T key);
+
+  #include "interleaved.cpp" //=> the implementaion file
+}
+
+#endif
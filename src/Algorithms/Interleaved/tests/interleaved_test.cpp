@@ -0,0 +1,79 @@
+/* >=====> Interleaved Lookup Tests <=====< */
+//=> Runs the coroutine lookups through schedule() at several widths (1, 3, WIDTH and more lookups in
+//=> flight than there are lookups) and on their own with get(): binary_search against std::lower_bound
+//=> on a sorted array with repeats, bst_find against std::binary_search on a balanced Node<int> tree.
+//=> Also checks that every lookup reaches the sink exactly once. Registered with ctest.
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <vector>
+#include <fmt/core.h>
+#include <interleaved.hpp>
+
+size_t expected(const std::vector<int>& values, int key){ //=> the first occurrence, or size_t(-1)
+  auto found = std::lower_bound(values.begin(), values.end(), key);
+  return (found != values.end() && *found == key) ? size_t(found - values.begin()) : size_t(-1);
+}
+
+Node<int>* build(std::vector<Node<int>>& nodes, const std::vector<int>& values, size_t low, size_t high){ //=> balanced over [low, high)
+  if(low >= high){ return nullptr; }
+  size_t mid = low + (high - low) / 2;
+  Node<int>& node = nodes.emplace_back(values[mid]);
+  if(Node<int>* left = build(nodes, values, low, mid)){ node.setLeft(*left); }
+  if(Node<int>* right = build(nodes, values, mid + 1, high)){ node.setRight(*right); }
+  return &node;
+}
+
+bool binary_search_matches(void){
+  std::mt19937 random(7);
+  std::vector<int> values(100003);
+  for(int& value : values){ value = int(random() % 150000); } //=> repeats and gaps
+  std::sort(values.begin(), values.end());
+  std::vector<int> keys(20000);
+  for(int& key : keys){ key = int(random() % 150010) - 5; } //=> some below and above every value
+
+  for(size_t width : {size_t(1), size_t(3), interleaved::WIDTH, keys.size() + 10}){
+    std::vector<int> seen(keys.size(), 0);
+    bool correct = true;
+    interleaved::schedule(keys.size(),
+      [&](size_t i){ return interleaved::binary_search(values.data(), keys[i], values.size()); },
+      [&](size_t i, size_t index){ seen[i]++; correct &= index == expected(values, keys[i]); },
+      width);
+    if(!correct || std::count(seen.begin(), seen.end(), 1) != std::ptrdiff_t(keys.size())){ return false; }
+  }
+  return interleaved::binary_search(values.data(), values[500], values.size()).get() == expected(values, values[500])
+      && interleaved::binary_search(values.data(), 1, size_t(0)).get() == size_t(-1);
+}
+
+bool bst_find_matches(void){
+  std::vector<int> values;
+  for(int i = 0; i < 5000; i++){ values.push_back(3 * i); }
+  std::vector<Node<int>> nodes;
+  nodes.reserve(values.size()); //=> the children are linked by address
+  const Node<int>* root = build(nodes, values, 0, values.size());
+
+  std::vector<int> keys;
+  for(int key = -2; key < 3 * 5000 + 2; key += 2){ keys.push_back(key); }
+  std::vector<int> seen(keys.size(), 0);
+  bool correct = true;
+  interleaved::schedule(keys.size(),
+    [&](size_t i){ return interleaved::bst_find(root, keys[i]); },
+    [&](size_t i, const Node<int>* node){
+      seen[i]++;
+      bool present = std::binary_search(values.begin(), values.end(), keys[i]);
+      correct &= present ? (node != nullptr && node->getData() == keys[i]) : node == nullptr;
+    });
+  return correct && std::count(seen.begin(), seen.end(), 1) == std::ptrdiff_t(keys.size())
+      && interleaved::bst_find(root, 42).get() != nullptr && interleaved::bst_find<int>(nullptr, 42).get() == nullptr;
+}
+
+int main(void){
+  int failed = 0;
+  auto check = [&failed](const char* name, bool passed){
+    fmt::print("{:>48} | {}\n", name, passed ? "ok" : "FAILED");
+    failed += !passed;
+  };
+  check("interleaved::binary_search == std::lower_bound", binary_search_matches());
+  check("interleaved::bst_find == std::binary_search", bst_find_matches());
+  return failed ? 1 : 0;
+}
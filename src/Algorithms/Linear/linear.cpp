@@ -19,16 +19,141 @@ size_t linear_search(T* arr, T key, size_t N){ //=> This Overloaded Version is f
   return LIMIT;
 }
 
+//=> 1-1-2. Parallel Linear Search || work = O(n), span = O(n / p), Space Complexity = O(p)
+//=> The range is cut into PAR_CHUNK sized chunks which the workers claim in increasing order
+//=> from a shared counter, so a worker never waits on a slow neighbour. Every hit lowers the
+//=> shared "best index found" with a CAS loop, and a worker stops as soon as the chunk (or the
+//=> position) it is looking at lies past that index, since nothing there can beat it anymore.
+//=> The result is the same first-occurrence index the serial version returns.
+template <class T>
+size_t par_linear_search(T* arr, T key, size_t N, size_t threads){
+  if(threads == 0){ threads = std::thread::hardware_concurrency(); }
+  if(threads <= 1 || N < PAR_MIN){ return linear_search(arr, key, N); }
+
+  size_t chunks = (N + PAR_CHUNK - 1) / PAR_CHUNK;
+  if(threads > chunks){ threads = chunks; }
+
+  std::atomic<size_t> next{0}; //=> the next unclaimed chunk
+  std::atomic<size_t> best{LIMIT}; //=> the smallest index found so far
+
+  auto worker = [&](){
+    for(size_t chunk = next.fetch_add(1, std::memory_order_relaxed); chunk < chunks;
+        chunk = next.fetch_add(1, std::memory_order_relaxed)){
+      size_t low = chunk * PAR_CHUNK;
+      if(low >= best.load(std::memory_order_relaxed)){ return; } //=> every later chunk loses too
+      size_t high = (low + PAR_CHUNK < N) ? low + PAR_CHUNK : N;
+
+      for(size_t i = low; i < high; i++){
+        if(arr[i] == key){
+          size_t current = best.load(std::memory_order_relaxed);
+          while(i < current && !best.compare_exchange_weak(current, i, std::memory_order_relaxed)){}
+          break;
+        }
+        //=> polling every 4K elements keeps the cancellation check off the hot path
+        if((i & 4095) == 0 && i > best.load(std::memory_order_relaxed)){ break; }
+      }
+    }
+  };
+
+  std::vector<std::jthread> pool;
+  pool.reserve(threads - 1);
+  for(size_t t = 1; t < threads; t++){ pool.emplace_back(worker); }
+  worker(); //=> the calling thread is a worker too
+  pool.clear(); //=> joins the workers
+
+  return best.load(std::memory_order_relaxed);
+}
+
+template <class T, size_t N>
+size_t par_linear_search(T (&arr)[N], T key, size_t threads){ //=> (&arr)[N] is an array reference not a pointer
+  return par_linear_search(static_cast<T*>(arr), key, N, threads);
+}
+
+//=> 1-1-3. Batched Multi-Key Linear Search || O(n * k) compares for k < BATCH_TABLE_MIN, O(n + k) expected otherwise, Space Complexity = O(k)
+//=> Both paths read the array exactly once and stop as soon as every key has been found.
+//=> Few keys: each cache line is compared against every key that is still missing; the compares
+//=>   over one line build a hit mask the compiler vectorizes, and a found key leaves the active list.
+//=> Many keys: the keys go into a small open-addressing table (load <= 1/2) and every element
+//=>   costs one hashed probe, no matter how many keys are asked for.
+//=> Duplicate keys are allowed, every copy gets the same index. Returns how many keys were found.
+template <class T>
+size_t linear_search_batch(T* arr, size_t N, const T* keys, size_t K, size_t* out){
+  for(size_t k = 0; k < K; k++){ out[k] = LIMIT; }
+  if(K == 0){ return 0; }
+
+  if(K < BATCH_TABLE_MIN){
+    constexpr size_t LINE = (BATCH_LINE / sizeof(T)) ? BATCH_LINE / sizeof(T) : 1;
+    static_assert(LINE <= 64, "the hit mask holds at most 64 elements");
+    size_t active[BATCH_TABLE_MIN], left = K; //=> ids of the keys that are still missing
+    for(size_t k = 0; k < K; k++){ active[k] = k; }
+
+    for(size_t low = 0; low < N && left; low += LINE){
+      size_t width = (N - low < LINE) ? N - low : LINE;
+      for(size_t a = 0; a < left; ){
+        const T& key = keys[active[a]];
+        unsigned long long mask = 0;
+        for(size_t j = 0; j < width; j++){ mask |= (unsigned long long)(arr[low + j] == key) << j; }
+        if(mask){
+          out[active[a]] = low + std::countr_zero(mask);
+          active[a] = active[--left]; //=> swap-remove, the moved key is checked next
+        }
+        else { a++; }
+      }
+    }
+    return K - left;
+  }
+
+  //=> the table stores key ids, chain links duplicate keys behind their first copy
+  size_t capacity = std::bit_ceil(2 * K), mask = capacity - 1;
+  std::vector<size_t> table(capacity, LIMIT), chain(K, LIMIT);
+  auto slot_of = [&](const T& key){ //=> fibonacci hashing spreads weak std::hash values (identity for int)
+    return (size_t)((std::hash<T>{}(key) * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+  };
+
+  size_t unique = 0;
+  for(size_t k = 0; k < K; k++){
+    size_t slot = slot_of(keys[k]);
+    while(table[slot] != LIMIT && !(keys[table[slot]] == keys[k])){ slot = (slot + 1) & mask; }
+    if(table[slot] == LIMIT){ table[slot] = k; unique++; }
+    else { chain[k] = chain[table[slot]]; chain[table[slot]] = k; }
+  }
+
+  size_t found = 0;
+  for(size_t i = 0; i < N && unique; i++){
+    size_t slot = slot_of(arr[i]);
+    while(table[slot] != LIMIT){
+      size_t k = table[slot];
+      if(keys[k] == arr[i]){
+        if(out[k] == LIMIT){
+          for(size_t d = k; d != LIMIT; d = chain[d]){ out[d] = i; found++; }
+          unique--;
+        }
+        break;
+      }
+      slot = (slot + 1) & mask;
+    }
+  }
+  return found;
+}
+
+template <class T, size_t N, size_t K>
+size_t linear_search_batch(T (&arr)[N], const T (&keys)[K], size_t (&out)[K]){ //=> (&arr)[N] is an array reference not a pointer
+  return linear_search_batch(static_cast<T*>(arr), N, static_cast<const T*>(keys), K, static_cast<size_t*>(out));
+}
+
 /* >-----> 1-2. Reccursive Linear Search ALgorithms <-----<*/
 
-//=> 1-2-1. Normal Linear Search || best = average = worst = O(n), Space Complexity = O(1)
+//=> 1-2-1. Normal Linear Search || best = average = worst = O(n), Space Complexity = O(log n)
+//=> Returns the last occurrence, as it always has. Recursing on halves (the right one first) instead
+//=> of once per element keeps the stack O(log n) deep, so large arrays no longer overflow it.
 template <class T> //=> Reccursive Linear Search Algorithm
 size_t rec_linear_search_algo(T* arr, T key, size_t N){
-  if(--N != LIMIT && N >= 0){
-    if (arr[N] == key) { return N; }
-    else { return rec_linear_search_algo(arr, key, N); }
-  }
-  return LIMIT;
+  if(N == 0){ return LIMIT; }
+  if(N == 1){ return (arr[0] == key) ? 0 : LIMIT; }
+  size_t half = N / 2;
+  size_t found = rec_linear_search_algo(arr + half, key, N - half);
+  if(found != LIMIT){ return half + found; }
+  return rec_linear_search_algo(arr, key, half);
 }
 
 template <class T, size_t N> //=> A Wrapper Function for Better Experience
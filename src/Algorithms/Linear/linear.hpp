@@ -2,10 +2,19 @@
 #define LINEAR_HPP
 
 #include <cstddef>
+#include <atomic> //=> for the shared "best index found"
+#include <thread> //=> for the worker threads
+#include <vector> //=> for holding the workers
+#include <functional> //=> for std::hash
+#include <bit> //=> for std::countr_zero & std::bit_ceil
 
 namespace linear{
   //=> Some Constants
   constexpr size_t LIMIT = -1;
+  constexpr size_t PAR_CHUNK = 1 << 16; //=> elements claimed by a worker at a time (256KB of int)
+  constexpr size_t PAR_MIN = 1 << 20; //=> below this size the serial version wins
+  constexpr size_t BATCH_LINE = 64; //=> bytes checked against all keys at once (one cache line)
+  constexpr size_t BATCH_TABLE_MIN = 16; //=> from this many keys on, the batch search builds a lookup table
 
   /* >=====> 1. Linear Search Algorithms <=====<*/
 
@@ -18,9 +27,23 @@ namespace linear{
   template <class T>
   size_t linear_search(T* arr, T key, size_t N); //=> This Overloaded Version is for manual size evaluation
 
+  //=> 1-1-2. Parallel Linear Search || work = O(n), span = O(n / p), Space Complexity = O(p)
+  template <class T, size_t N>
+  size_t par_linear_search(T (&arr)[N], T key, size_t threads = 0); //=> threads = 0 means std::thread::hardware_concurrency()
+
+  template <class T>
+  size_t par_linear_search(T* arr, T key, size_t N, size_t threads = 0); //=> This Overloaded Version is for manual size evaluation
+
+  //=> 1-1-3. Batched Multi-Key Linear Search || O(n * k) compares for k < BATCH_TABLE_MIN, O(n + k) expected otherwise, Space Complexity = O(k)
+  template <class T, size_t N, size_t K>
+  size_t linear_search_batch(T (&arr)[N], const T (&keys)[K], size_t (&out)[K]); //=> out[i] = first index of keys[i] or LIMIT
+
+  template <class T>
+  size_t linear_search_batch(T* arr, size_t N, const T* keys, size_t K, size_t* out); //=> This Overloaded Version is for manual size evaluation
+
   /* >-----> 1-2. Reccursive Linear Search ALgorithms <-----<*/
 
-  //=> 1-2-1. Normal Linear Search || best = average = worst = O(n), Space Complexity = O(1)
+  //=> 1-2-1. Normal Linear Search || best = average = worst = O(n), Space Complexity = O(log n)
   template <class T> //=> Reccursive Linear Search Algorithm
   size_t rec_linear_search_algo(T* arr, T key, size_t N);
 
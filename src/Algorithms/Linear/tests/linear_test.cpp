@@ -0,0 +1,83 @@
+/* >=====> Linear Search Tests <=====< */
+//=> Compares par_linear_search against std::find on arrays past PAR_MIN (so the workers really run),
+//=> with 1 to 8 threads: first, middle, last and missing keys, and a key stored in several chunks.
+//=> Compares linear_search_batch against one std::find per key, below and above BATCH_TABLE_MIN keys
+//=> (the cache-line path and the table path), with duplicate and missing keys and a ragged last line.
+//=> Compares rec_linear_search against std::find over reverse iterators (it returns the last occurrence),
+//=> on an array long enough to overflow the stack if it recursed once per element.
+//=> Registered with ctest; exits non-zero on any failure.
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include <fmt/core.h>
+#include <linear.hpp>
+
+size_t expected(const std::vector<int>& values, int key){ //=> the first occurrence, or linear::LIMIT
+  auto found = std::find(values.begin(), values.end(), key);
+  return found == values.end() ? linear::LIMIT : size_t(found - values.begin());
+}
+
+bool parallel_matches_find(void){
+  std::vector<int> values(3 * linear::PAR_MIN + 12345);
+  for(size_t i = 0; i < values.size(); i++){ values[i] = int(i); }
+  values[5 * linear::PAR_CHUNK + 3] = values[2 * linear::PAR_CHUNK + 1] = values[values.size() - 2] = -7; //=> the first copy must win
+
+  int keys[] = {0, int(values.size() / 2), int(values.size() - 1), -7, -1, int(values.size())};
+  for(size_t threads : {1, 2, 3, 4, 8}){
+    for(int key : keys){
+      if(linear::par_linear_search(values.data(), key, values.size(), threads) != expected(values, key)){ return false; }
+    }
+  }
+  int small[] = {4, 8, 15, 16, 23, 42}; //=> below PAR_MIN, the serial path
+  return linear::par_linear_search(small, 23) == 4 && linear::par_linear_search(small, 7) == linear::LIMIT;
+}
+
+bool batch_matches_find(void){
+  std::vector<int> values(10007); //=> not a multiple of a cache line
+  for(size_t i = 0; i < values.size(); i++){ values[i] = int((i * 7919) % 5003); } //=> every value twice or more
+
+  for(size_t count : {size_t(1), size_t(3), linear::BATCH_TABLE_MIN - 1, linear::BATCH_TABLE_MIN, size_t(100)}){
+    std::vector<int> keys;
+    for(size_t k = 0; k < count; k++){ keys.push_back(int((k * 104729) % 6000)); } //=> some above 5002, so missing
+    keys.push_back(keys.front()); //=> a duplicate key
+    keys.push_back(int(values.back()));
+
+    std::vector<size_t> out(keys.size());
+    size_t found = linear::linear_search_batch(values.data(), values.size(), keys.data(), keys.size(), out.data());
+    size_t hits = 0;
+    for(size_t k = 0; k < keys.size(); k++){
+      if(out[k] != expected(values, keys[k])){ return false; }
+      hits += out[k] != linear::LIMIT;
+    }
+    if(found != hits){ return false; }
+  }
+  int small[] = {4, 8, 15, 16, 23, 42};
+  const int keys[] = {42, 5, 4};
+  size_t out[3];
+  return linear::linear_search_batch(small, keys, out) == 2 && out[0] == 5 && out[1] == linear::LIMIT && out[2] == 0;
+}
+
+bool recursive_matches_find(void){
+  std::vector<int> values(1 << 22);
+  for(size_t i = 0; i < values.size(); i++){ values[i] = int(i % 1000); }
+  for(int key : {0, 999, 500, -1, 1000}){
+    auto last = std::find(values.rbegin(), values.rend(), key);
+    size_t index = (last == values.rend()) ? linear::LIMIT : size_t(values.rend() - last) - 1;
+    if(linear::rec_linear_search(values.data(), key, values.size()) != index){ return false; }
+  }
+  int small[] = {4, 8, 4, 16};
+  return linear::rec_linear_search(small, 4) == 2 && linear::rec_linear_search(small, 16) == 3
+      && linear::rec_linear_search(small, 5) == linear::LIMIT && linear::rec_linear_search(small, 4, 0) == linear::LIMIT;
+}
+
+int main(void){
+  int failed = 0;
+  auto check = [&failed](const char* name, bool passed){
+    fmt::print("{:>48} | {}\n", name, passed ? "ok" : "FAILED");
+    failed += !passed;
+  };
+  check("par_linear_search == std::find", parallel_matches_find());
+  check("linear_search_batch == std::find per key", batch_matches_find());
+  check("rec_linear_search == last std::find", recursive_matches_find());
+  return failed ? 1 : 0;
+}
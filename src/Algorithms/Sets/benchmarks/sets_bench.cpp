@@ -0,0 +1,64 @@
+/* >=====> Sorted-Set Intersection Benchmark <=====< */
+//=> A long list of 2^max elements (argv[1], default 22) against short lists 1 up to 4096 times
+//=> shorter, both drawn from a universe 4 times the long list: nanoseconds per element of the short
+//=> list for one binary::binary_search per element (the old way), the merge, SIMD and galloping
+//=> kernels, and sets::set_intersection, which picks one of them from the ratio.
+//=> Build with: cmake -S . -B build -DCMAKE_BUILD_TYPE=Release -DBUILD_BENCHMARKS=ON
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include <fmt/core.h>
+#include <binary.hpp>
+#include <sets.hpp>
+
+using element = std::uint32_t;
+
+std::vector<element> sorted_set(std::mt19937_64& random, size_t N, size_t universe){
+  std::vector<element> values(N);
+  for(element& value : values){ value = element(random() % universe); }
+  std::sort(values.begin(), values.end());
+  values.erase(std::unique(values.begin(), values.end()), values.end());
+  return values;
+}
+
+template<class Kernel>
+double measure(size_t per, size_t rounds, Kernel kernel, size_t& checksum){
+  auto start = std::chrono::steady_clock::now();
+  for(size_t round = 0; round < rounds; round++){ checksum += kernel(); }
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(stop - start).count() / double(per * rounds);
+}
+
+int main(int argc, char** argv){
+  size_t max_log = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 22;
+  std::mt19937_64 random(42);
+  size_t L = size_t(1) << max_log, universe = 4 * L;
+  std::vector<element> large = sorted_set(random, L, universe);
+  std::vector<element> out(large.size());
+
+  fmt::print("{:>7} | {:>12} | {:>9} | {:>9} | {:>9} | {:>9} | {:>9}\n", "ratio", "binary each", "merge", "simd", "gallop", "auto", "matches");
+  for(size_t ratio = 1; ratio <= 4096; ratio *= 4){
+    std::vector<element> small = sorted_set(random, L / ratio, universe);
+    size_t S = small.size(), rounds = ratio, checksum = 0;
+    const element* a = small.data();
+    const element* b = large.data();
+    size_t B = large.size();
+
+    double each = measure(S, rounds, [&]{
+      size_t count = 0;
+      for(size_t i = 0; i < S; i++){ if(binary::binary_search(const_cast<element*>(b), a[i], B) != size_t(-1)){ out[count++] = a[i]; } }
+      return count;
+    }, checksum);
+    double merge = measure(S, rounds, [&]{ return sets::intersect_merge(a, S, b, B, out.data()); }, checksum);
+    double simd = measure(S, rounds, [&]{ return sets::intersect_simd(a, S, b, B, out.data()); }, checksum);
+    double gallop = measure(S, rounds, [&]{ return sets::intersect_gallop(a, S, b, B, out.data()); }, checksum);
+    double chosen = measure(S, rounds, [&]{ return sets::set_intersection(a, S, b, B, out.data()); }, checksum);
+
+    fmt::print("{:>7} | {:>9.2f} ns | {:>6.2f} ns | {:>6.2f} ns | {:>6.2f} ns | {:>6.2f} ns | {:>9}\n",
+               ratio, each, merge, simd, gallop, chosen, checksum / (5 * rounds));
+  }
+  return 0;
+}
@@ -0,0 +1,212 @@
+/* >=====> 0. Helpers <=====< */
+//=> First index >= x in arr[from, N), with everything before from known to be < x. Probes start
+//=> one expected gap (step = long / short length) away and double, then bisect the last stride:
+//=> about log(gap) + 1 probes where plain galloping from 1 pays 2 log(gap).
+template<class T>
+inline size_t gallop(const T* arr, size_t N, const T& x, size_t from, size_t step) noexcept {
+  size_t high = from + step;
+  while(high < N && arr[high] < x){ from = high + 1; step *= 2; high = from + step; }
+  if(high > N){ high = N; }
+  return from + binary::lower_bound(arr + from, x, high - from);
+}
+
+//=> Does one of the LANES elements at block equal x? (SIMD for 32/64-bit integers under AVX2)
+template<class T>
+constexpr bool SIMD_ELEMENT = std::is_integral_v<T> && (sizeof(T) == 4 || sizeof(T) == 8);
+
+template<class T>
+constexpr size_t LANES = 32 / sizeof(T);
+
+#if defined(__AVX2__)
+template<class T>
+inline bool block_has(const T* block, T x) noexcept {
+  __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+  __m256i equal;
+  if constexpr (sizeof(T) == 4){ equal = _mm256_cmpeq_epi32(values, _mm256_set1_epi32(int(x))); }
+  else { equal = _mm256_cmpeq_epi64(values, _mm256_set1_epi64x((long long)(x))); }
+  return !_mm256_testz_si256(equal, equal);
+}
+#endif
+
+//=> V1/V3 skeleton shared by intersection and difference: Keep = true reports the elements of
+//=> a found in b, Keep = false the ones missing from b. a should be the shorter list.
+template<bool Keep, class T>
+size_t block_scan(const T* a, size_t A, const T* b, size_t B, T* out){
+#if defined(__AVX2__)
+  if constexpr (SIMD_ELEMENT<T>){
+    constexpr size_t W = LANES<T>;
+    size_t count = 0, j = 0;
+    for(size_t i = 0; i < A; i++){
+      T x = a[i];
+      while(j + 4 * W <= B && b[j + 4 * W - 1] < x){ j += 4 * W; } //=> V3: big strides first
+      while(j + W <= B && b[j + W - 1] < x){ j += W; } //=> V1: then block by block
+      bool found;
+      if(j + W <= B){ found = block_has(b + j, x); } //=> x <= b[j + W - 1], so it is here or nowhere
+      else {
+        while(j < B && b[j] < x){ j++; } //=> the tail, shorter than a block
+        found = (j < B && b[j] == x);
+      }
+      if(found == Keep){ out[count++] = x; }
+    }
+    return count;
+  }
+#endif
+  if constexpr (Keep){ return intersect_merge(a, A, b, B, out); }
+  else { //=> scalar: merge keeping the misses
+    size_t i = 0, j = 0, count = 0;
+    while(i < A && j < B){
+      if(a[i] < b[j]){ out[count++] = a[i++]; }
+      else { i += !(b[j] < a[i]); j++; }
+    }
+    for(; i < A; i++){ out[count++] = a[i]; }
+    return count;
+  }
+}
+
+/* >=====> 1. Intersection <=====< */
+template<class T> //=> Worst = Average = O(A + B), Space Complexity = O(1)
+size_t intersect_merge(const T* a, size_t A, const T* b, size_t B, T* out){
+  size_t i = 0, j = 0, count = 0;
+  while(i < A && j < B){ //=> branch-free: the comparisons become index increments
+    T x = a[i], y = b[j];
+    out[count] = x;
+    count += (x == y);
+    i += !(y < x);
+    j += !(x < y);
+  }
+  return count;
+}
+
+template<class T> //=> Worst = Average = O(A log(B / A)) for A <= B, Space Complexity = O(1)
+size_t intersect_gallop(const T* a, size_t A, const T* b, size_t B, T* out){
+  size_t count = 0, j = 0, step = A ? (B / A ? B / A : 1) : 1;
+  if(step >= BISECT_RATIO){ //=> whole-array searches share their (cached) top levels, gallops don't
+    for(size_t i = 0; i < A; i++){
+      j = binary::lower_bound(b, a[i], B);
+      if(j < B && b[j] == a[i]){ out[count++] = a[i]; }
+    }
+    return count;
+  }
+  for(size_t i = 0; i < A && j < B; i++){
+    j = gallop(b, B, a[i], j, step); //=> from the previous position
+    if(j < B && b[j] == a[i]){ out[count++] = a[i]; j++; }
+  }
+  return count;
+}
+
+template<class T> //=> Worst = Average = O(A + B / lanes), Space Complexity = O(1)
+size_t intersect_simd(const T* a, size_t A, const T* b, size_t B, T* out){
+  return (A <= B) ? block_scan<true>(a, A, b, B, out) : block_scan<true>(b, B, a, A, out);
+}
+
+template<class T> //=> Worst = O(min(A, B) * log(max / min)) or O(A + B), whichever applies, Space Complexity = O(1)
+size_t set_intersection(const T* a, size_t A, const T* b, size_t B, T* out){
+  if(A == 0 || B == 0){ return 0; }
+  size_t ratio = (A < B) ? B / A : A / B;
+#if defined(__AVX2__)
+  if constexpr (SIMD_ELEMENT<T>){
+    if(ratio >= SIMD_GALLOP_RATIO){ return (A < B) ? intersect_gallop(a, A, b, B, out) : intersect_gallop(b, B, a, A, out); }
+    if(ratio >= SIMD_RATIO){ return intersect_simd(a, A, b, B, out); }
+    return intersect_merge(a, A, b, B, out);
+  }
+#endif
+  if(ratio >= GALLOP_RATIO){ return (A < B) ? intersect_gallop(a, A, b, B, out) : intersect_gallop(b, B, a, A, out); }
+  return intersect_merge(a, A, b, B, out);
+}
+
+template<class T, size_t A, size_t B> //=> (&a)[A] is an array reference, not a pointer.
+size_t set_intersection(const T (&a)[A], const T (&b)[B], T* out){
+  return set_intersection(static_cast<const T*>(a), A, static_cast<const T*>(b), B, out);
+}
+
+/* >=====> 2. K-Way Intersection <=====< */
+template<class T> //=> Worst = O(k * min * log(max / min)), Space Complexity = O(k)
+size_t k_way_intersection(const T* const* lists, const size_t* sizes, size_t K, T* out){
+  if(K == 0){ return 0; }
+  std::vector<size_t> order(K);
+  for(size_t i = 0; i < K; i++){ order[i] = i; }
+  std::sort(order.begin(), order.end(), [sizes](size_t x, size_t y){ return sizes[x] < sizes[y]; });
+
+  if(K == 1){
+    std::copy(lists[order[0]], lists[order[0]] + sizes[order[0]], out);
+    return sizes[order[0]];
+  }
+  size_t count = set_intersection(lists[order[0]], sizes[order[0]], lists[order[1]], sizes[order[1]], out);
+  for(size_t k = 2; k < K && count != 0; k++){ //=> out is the first list, which the kernels allow
+    count = set_intersection(static_cast<const T*>(out), count, lists[order[k]], sizes[order[k]], out);
+  }
+  return count;
+}
+
+/* >=====> 3. Union <=====< */
+template<class T> //=> Worst = O(A + B) (the output), Space Complexity = O(1)
+size_t set_union(const T* a, size_t A, const T* b, size_t B, T* out){
+  if(A / GALLOP_RATIO >= B || B / GALLOP_RATIO >= A){ //=> copy runs of the long list between the short one's elements
+    const T* small = (A < B) ? a : b;
+    const T* large = (A < B) ? b : a;
+    size_t S = (A < B) ? A : B, L = (A < B) ? B : A;
+    size_t count = 0, j = 0, step = L / (S ? S : 1);
+    for(size_t i = 0; i < S; i++){
+      size_t next = gallop(large, L, small[i], j, step);
+      out = std::copy(large + j, large + next, out);
+      count += next - j;
+      j = next;
+      if(j < L && large[j] == small[i]){ j++; }
+      *out++ = small[i];
+      count++;
+    }
+    std::copy(large + j, large + L, out);
+    return count + (L - j);
+  }
+  size_t i = 0, j = 0, count = 0;
+  while(i < A && j < B){ //=> branch-free merge
+    T x = a[i], y = b[j];
+    bool take_a = !(y < x);
+    out[count++] = take_a ? x : y;
+    i += take_a;
+    j += !(x < y);
+  }
+  for(; i < A; i++){ out[count++] = a[i]; }
+  for(; j < B; j++){ out[count++] = b[j]; }
+  return count;
+}
+
+template<class T, size_t A, size_t B> //=> (&a)[A] is an array reference, not a pointer.
+size_t set_union(const T (&a)[A], const T (&b)[B], T* out){
+  return set_union(static_cast<const T*>(a), A, static_cast<const T*>(b), B, out);
+}
+
+/* >=====> 4. Difference <=====< */
+template<class T> //=> Worst = O(A + B), Space Complexity = O(1)
+size_t set_difference(const T* a, size_t A, const T* b, size_t B, T* out){
+  if(B == 0){
+    if(out != a){ std::copy(a, a + A, out); }
+    return A;
+  }
+  if(A == 0){ return 0; }
+  if(B / GALLOP_RATIO >= A){ //=> a is short: look every element up in b
+    size_t count = 0, j = 0, step = B / A;
+    for(size_t i = 0; i < A; i++){
+      j = gallop(b, B, a[i], j, step);
+      if(j == B || !(b[j] == a[i])){ out[count++] = a[i]; }
+    }
+    return count;
+  }
+  if(A / GALLOP_RATIO >= B){ //=> b is short: copy the runs of a between its elements
+    size_t count = 0, i = 0, step = A / B;
+    for(size_t j = 0; j < B && i < A; j++){
+      size_t next = gallop(a, A, b[j], i, step);
+      if(out + count != a + i){ std::copy(a + i, a + next, out + count); }
+      count += next - i;
+      i = (next < A && a[next] == b[j]) ? next + 1 : next;
+    }
+    if(out + count != a + i){ std::copy(a + i, a + A, out + count); }
+    return count + (A - i);
+  }
+  return block_scan<false>(a, A, b, B, out); //=> SIMD when T allows it
+}
+
+template<class T, size_t A, size_t B> //=> (&a)[A] is an array reference, not a pointer.
+size_t set_difference(const T (&a)[A], const T (&b)[B], T* out){
+  return set_difference(static_cast<const T*>(a), A, static_cast<const T*>(b), B, out);
+}
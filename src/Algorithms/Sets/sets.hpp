@@ -0,0 +1,78 @@
+#ifndef SETS_HPP
+#define SETS_HPP
+
+#include <cstddef> //=> for size_t
+#include <algorithm> //=> for std::copy & std::sort
+#include <type_traits> //=> for the SIMD dispatch
+#include <vector> //=> for the k-way order
+#if defined(__AVX2__)
+  #include <immintrin.h>
+#endif
+#include <Algorithms/Divide_and_Conquer/Search/Binary/binary.hpp> //=> for binary::lower_bound
+
+namespace sets{
+  //=> Some Constants
+  constexpr size_t GALLOP_RATIO = 16; //=> from this length ratio on, galloping beats the merge
+  constexpr size_t SIMD_RATIO = 8; //=> from this ratio on, the SIMD block compare beats the merge
+  constexpr size_t SIMD_GALLOP_RATIO = 512; //=> and from this one on, galloping beats the block compare
+  constexpr size_t BISECT_RATIO = 512; //=> from this one on, whole-array binary searches beat galloping
+
+  //=> All kernels take sorted lists of distinct elements, write the result (sorted) to out and return its
+  //=> length. out needs min(A, B) room for an intersection, A for a difference and A + B for a union,
+  //=> and may be the first list itself: the writes never overtake the reads of a.
+
+  /* >=====> 1. Intersection <=====< */
+  //=> Picks the kernel from the size ratio. For 32/64-bit integers with AVX2: the merge below
+  //=> SIMD_RATIO, the SIMD block compare up to SIMD_GALLOP_RATIO, galloping past it. Otherwise the
+  //=> merge below GALLOP_RATIO and galloping past it.
+  template<class T> //=> Worst = O(min(A, B) * log(max / min)) or O(A + B), whichever applies, Space Complexity = O(1)
+  size_t set_intersection(const T* a, size_t A, const T* b, size_t B, T* out);
+
+  template<class T, size_t A, size_t B> //=> (&a)[A] is an array reference, not a pointer.
+  size_t set_intersection(const T (&a)[A], const T (&b)[B], T* out);
+
+  //=> The kernels behind it, for callers that know better.
+  template<class T> //=> Worst = Average = O(A + B), Space Complexity = O(1)
+  size_t intersect_merge(const T* a, size_t A, const T* b, size_t B, T* out);
+
+  //=> Gallops from the last match (see gallop in sets.cpp); past BISECT_RATIO it bisects the whole
+  //=> list instead, since the top levels of those searches stay in cache from one element to the next.
+  template<class T> //=> Worst = Average = O(A log(B / A)) for A <= B, Space Complexity = O(1)
+  size_t intersect_gallop(const T* a, size_t A, const T* b, size_t B, T* out);
+
+  //=> V1/V3 style (Lemire, Boytsov & Kurz): for every element x of the shorter list, skip the longer
+  //=> one 4 blocks, then 1 block at a time while its last element is < x, then compare x against the
+  //=> whole block (8 x 32-bit or 4 x 64-bit) with one vector compare. Falls back to intersect_merge
+  //=> for other element types or without AVX2.
+  template<class T> //=> Worst = Average = O(A + B / lanes), Space Complexity = O(1)
+  size_t intersect_simd(const T* a, size_t A, const T* b, size_t B, T* out);
+
+  /* >=====> 2. K-Way Intersection <=====< */
+  //=> Intersects the smallest two lists first, then the running result with the next smallest: the
+  //=> result never grows, so every later step is a short list against a long one and gallops.
+  template<class T> //=> Worst = O(k * min * log(max / min)), Space Complexity = O(k)
+  size_t k_way_intersection(const T* const* lists, const size_t* sizes, size_t K, T* out); //=> out needs room for the shortest list
+
+  /* >=====> 3. Union <=====< */
+  //=> Galloping through the longer list copies whole runs at once when the lengths are GALLOP_RATIO
+  //=> apart, otherwise a branch-free merge.
+  template<class T> //=> Worst = O(A + B) (the output), Space Complexity = O(1)
+  size_t set_union(const T* a, size_t A, const T* b, size_t B, T* out); //=> out must not alias a or b
+
+  template<class T, size_t A, size_t B> //=> (&a)[A] is an array reference, not a pointer.
+  size_t set_union(const T (&a)[A], const T (&b)[B], T* out);
+
+  /* >=====> 4. Difference <=====< */
+  //=> a minus b: gallops in b per element of a when a is GALLOP_RATIO times shorter, copies the runs
+  //=> of a between the elements of b when b is, and otherwise runs the SIMD block compare reporting
+  //=> the misses (or the merge without AVX2).
+  template<class T> //=> Worst = O(A + B), Space Complexity = O(1)
+  size_t set_difference(const T* a, size_t A, const T* b, size_t B, T* out);
+
+  template<class T, size_t A, size_t B> //=> (&a)[A] is an array reference, not a pointer.
+  size_t set_difference(const T (&a)[A], const T (&b)[B], T* out);
+
+  #include "sets.cpp" //=> the implementaion file
+}
+
+#endif
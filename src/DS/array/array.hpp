@@ -5,16 +5,26 @@
 #include <algorithm>
 #include <stdexcept>
 #include <iterator>
+#include <cstring>
+#include <type_traits>
+#include <utility>
 namespace DSA{
     using size_t = long unsigned int;
-    template<class T, size_t S>
+    struct array_expression {}; //base of the lazy element-wise expressions (array_expr.hpp)
+
+    //=> A is the alignment of the storage: alignof(T) by default, 32 or 64 to start on an AVX2 register or
+    //=> a cache line (no load of the data straddles two lines), 4096 to start on a page.
+    template<class T, size_t S, size_t A = alignof(T)>
     class array {
+        static_assert(A >= alignof(T) && (A & (A - 1)) == 0, "Error: Alignment must be a power of two, at least alignof(T)!");
         private:
-            T elements[S ? S : 1]; //C-Style array
+            alignas(A) T elements[S ? S : 1]; //C-Style array
+            static constexpr size_t LANES = sizeof(T) < 64 ? 64 / sizeof(T) : 1; //independent accumulators, two AVX2 registers wide
+            static constexpr bool BITWISE = std::is_trivially_copyable_v<T>; //copies may go through memcpy/memmove
         public:
             /*assigning*/
             array() = default; //declaration
-            array(std::initializer_list<T> list){ //assigning with a list
+            constexpr array(std::initializer_list<T> list) : elements{} { //assigning with a list (usable in constant expressions, the rest is value-initialized)
                 if(list.size() > S) { throw std::out_of_range("Error: Size is exceeded!"); }
                 size_t index = 0;
                 for(const T& element : list){ 
@@ -23,6 +33,8 @@ namespace DSA{
                 }
             }
 
+            constexpr array(const array& other) = default; //copying (declared, as operator= below is user-provided)
+
             constexpr void operator=(std::initializer_list<T> list)  { //assigning with an other object (Copy constructure)
                 if(list.size() > S) { throw std::out_of_range("Error: Size is exceeded!"); }
                 size_t index = 0;
@@ -33,12 +45,24 @@ namespace DSA{
             } 
 
             constexpr void operator=(const array& other){ //assigning with an other object (Copy constructure)
+                if constexpr (BITWISE){
+                    if(!std::is_constant_evaluated()){ std::memmove(this->elements, other.elements, S * sizeof(T)); return; } //memmove: self-assignment is fine; S * sizeof(T), not the placeholder slot of S == 0
+                }
                 size_t index = 0;
                 for(const T& element : other){
                     this->elements[index] = element;
                     ++index;
                 }
             } 
+
+            template<class E> requires std::is_base_of_v<array_expression, E>
+            constexpr array(const E& expression){ this->operator=(expression); } //evaluating an expression such as a + b * c
+
+            template<class E> requires std::is_base_of_v<array_expression, E>
+            constexpr void operator=(const E& expression){ //one fused loop, no temporaries (the expression only reads index i to write index i)
+                static_assert(E::extent == S || E::extent == 0, "Error: Sizes do not match!");
+                for(size_t i = 0; i < S; i++){ this->elements[i] = T(expression[i]); }
+            }
             ~array() = default;//destructor
 
 
@@ -91,7 +115,100 @@ namespace DSA{
             //operations
             constexpr void fill (const T& value){ std::fill_n(elements, S, value); }
 
-            constexpr void swap (array& other) noexcept(std::is_nothrow_swappable_v<T>) { std::swap_ranges(this->elements, this->end(), other.begin()); }
+            constexpr void swap (array& other) noexcept(std::is_nothrow_swappable_v<T>) {
+                if constexpr (BITWISE){
+                    if(!std::is_constant_evaluated()){ //through a small buffer, 256 bytes at a time
+                        unsigned char buffer[256];
+                        unsigned char* mine = reinterpret_cast<unsigned char*>(this->elements);
+                        unsigned char* theirs = reinterpret_cast<unsigned char*>(other.elements);
+                        for(size_t done = 0; done < S * sizeof(T); done += sizeof(buffer)){
+                            size_t bytes = std::min(sizeof(buffer), S * sizeof(T) - done);
+                            std::memcpy(buffer, mine + done, bytes);
+                            std::memmove(mine + done, theirs + done, bytes); //memmove: swapping with itself is fine
+                            std::memcpy(theirs + done, buffer, bytes);
+                        }
+                        return;
+                    }
+                }
+                std::swap_ranges(this->elements, this->end(), other.begin());
+            }
+
+            //reductions || O(n), written as LANES independent accumulators so that the loops map onto SIMD registers
+            constexpr T sum(void) const noexcept {
+                T lanes[LANES] = {};
+                size_t i = 0;
+                for(; i + LANES <= S; i += LANES){ for(size_t l = 0; l < LANES; l++){ lanes[l] += this->elements[i + l]; } }
+                T total{};
+                for(size_t l = 0; l < LANES; l++){ total += lanes[l]; }
+                for(; i < S; i++){ total += this->elements[i]; }
+                return total;
+            }
+
+            constexpr T min(void) const noexcept { return this->minmax().first; } //smallest element
+            constexpr T max(void) const noexcept { return this->minmax().second; } //largest element
+            constexpr std::pair<T, T> minmax(void) const noexcept { //both in one pass
+                static_assert(S > 0, "Error: An empty array has no minimum or maximum!");
+                T low[LANES], high[LANES];
+                for(size_t l = 0; l < LANES; l++){ low[l] = high[l] = this->elements[0]; }
+                size_t i = 0;
+                for(; i + LANES <= S; i += LANES){
+                    for(size_t l = 0; l < LANES; l++){ //the ternaries become vector min/max instructions
+                        const T& element = this->elements[i + l];
+                        low[l] = element < low[l] ? element : low[l];
+                        high[l] = high[l] < element ? element : high[l];
+                    }
+                }
+                for(; i < S; i++){
+                    low[0] = this->elements[i] < low[0] ? this->elements[i] : low[0];
+                    high[0] = high[0] < this->elements[i] ? this->elements[i] : high[0];
+                }
+                for(size_t l = 1; l < LANES; l++){
+                    low[0] = low[l] < low[0] ? low[l] : low[0];
+                    high[0] = high[0] < high[l] ? high[l] : high[0];
+                }
+                return {low[0], high[0]};
+            }
+
+            constexpr size_t count(const T& value) const noexcept { //number of elements equal to value
+                size_t total = 0;
+                for(size_t i = 0; i < S; i++){ total += (this->elements[i] == value); } //branch-free
+                return total;
+            }
+
+            template<class Predicate>
+            constexpr bool any_of(Predicate predicate) const { //tests blocks of 64 without branching, exits between blocks
+                constexpr size_t BLOCK = 64;
+                size_t i = 0;
+                for(; i + BLOCK <= S; i += BLOCK){
+                    bool hit = false;
+                    for(size_t j = 0; j < BLOCK; j++){ hit |= bool(predicate(this->elements[i + j])); }
+                    if(hit){ return true; }
+                }
+                for(; i < S; i++){ if(predicate(this->elements[i])){ return true; } }
+                return false;
+            }
+
+            constexpr bool equal(const array& other) const noexcept { //element-wise ==
+                if constexpr (S == 0){ return true; } //the placeholder slot is never initialized
+                if constexpr (std::has_unique_object_representations_v<T>){ //equal values <=> equal bytes (not for floats: -0.0, NaN)
+                    if(!std::is_constant_evaluated()){ return std::memcmp(this->elements, other.elements, S * sizeof(T)) == 0; }
+                }
+                bool same = true;
+                for(size_t i = 0; i < S; i++){ same &= (this->elements[i] == other.elements[i]); }
+                return same;
+            }
+            friend constexpr bool operator==(const array& left, const array& right) noexcept { return left.equal(right); }
+
+            //element-wise arithmetic in place (with an other array, an expression or a scalar)
+            template<class E>
+            constexpr void operator+=(const E& other){ this->operator=(*this + other); }
+            template<class E>
+            constexpr void operator-=(const E& other){ this->operator=(*this - other); }
+            template<class E>
+            constexpr void operator*=(const E& other){ this->operator=(*this * other); }
+            template<class E>
+            constexpr void operator/=(const E& other){ this->operator=(*this / other); }
     };
 }
+#include "array_expr.hpp" //the element-wise expressions
 #endif
@@ -0,0 +1,88 @@
+#ifndef ARRAY_EXPR_HPP
+#define ARRAY_EXPR_HPP
+
+#include <functional>
+#include <type_traits>
+#include "array.hpp"
+
+namespace DSA{
+    /* >=====> Element-Wise Expressions <=====< */
+    //=> a + b * c does not compute anything: it builds a small object that knows how to compute one
+    //=> element, result[i] = a[i] + b[i] * c[i]. Assigning it to a DSA::array runs a single loop over
+    //=> i with no temporary arrays, which the compiler can vectorize as a whole.
+    //=> Arrays are held by reference and sub-expressions by value, so an expression must be assigned
+    //=> (or reduced) within the statement that builds it when it refers to temporary arrays.
+
+    template<class E>
+    struct is_array_operand : std::is_base_of<array_expression, E> {};
+    template<class T, size_t S, size_t A>
+    struct is_array_operand<array<T, S, A>> : std::true_type {};
+    template<class E>
+    constexpr bool is_array_operand_v = is_array_operand<std::remove_cvref_t<E>>::value;
+
+    template<class E>
+    struct operand_extent { static constexpr size_t value = E::extent; };
+    template<class T, size_t S, size_t A>
+    struct operand_extent<array<T, S, A>> { static constexpr size_t value = S; };
+
+    template<class E>
+    struct operand_storage { using type = E; }; //sub-expressions: by value (they are tiny)
+    template<class T, size_t S, size_t A>
+    struct operand_storage<array<T, S, A>> { using type = const array<T, S, A>&; }; //arrays: by reference
+
+    template<class T>
+    struct scalar_operand : array_expression { //a scalar on one side, the same value at every index
+        static constexpr size_t extent = 0; //matches any size
+        T value;
+        constexpr explicit scalar_operand(const T& value) : value(value) {}
+        constexpr const T& operator[](size_t) const noexcept { return value; }
+    };
+
+    template<class Operation, class L, class R>
+    struct binary_expression : array_expression {
+        static constexpr size_t extent = operand_extent<L>::value ? operand_extent<L>::value : operand_extent<R>::value;
+        static_assert(operand_extent<L>::value == operand_extent<R>::value || operand_extent<L>::value == 0 || operand_extent<R>::value == 0, "Error: Sizes do not match!");
+        typename operand_storage<L>::type left;
+        typename operand_storage<R>::type right;
+        constexpr binary_expression(const L& left, const R& right) : left(left), right(right) {}
+        constexpr auto operator[](size_t i) const { return Operation{}(left[i], right[i]); }
+        static constexpr size_t size(void) noexcept { return extent; }
+    };
+
+    template<class Operation, class E>
+    struct unary_expression : array_expression {
+        static constexpr size_t extent = operand_extent<E>::value;
+        typename operand_storage<E>::type operand;
+        constexpr explicit unary_expression(const E& operand) : operand(operand) {}
+        constexpr auto operator[](size_t i) const { return Operation{}(operand[i]); }
+        static constexpr size_t size(void) noexcept { return extent; }
+    };
+
+    //=> either side may be a scalar, as long as the other one is an array or an expression
+    template<class X>
+    constexpr decltype(auto) as_operand(const X& x){
+        if constexpr (is_array_operand_v<X>){ return (x); }
+        else { return scalar_operand<X>(x); }
+    }
+    template<class L, class R>
+    concept array_operands = (is_array_operand_v<L> && (is_array_operand_v<R> || std::is_arithmetic_v<R>)) || (std::is_arithmetic_v<L> && is_array_operand_v<R>);
+
+    template<class Operation, class L, class R>
+    constexpr auto make_binary(const L& left, const R& right){
+        using left_type = std::remove_cvref_t<decltype(as_operand(left))>;
+        using right_type = std::remove_cvref_t<decltype(as_operand(right))>;
+        return binary_expression<Operation, left_type, right_type>(as_operand(left), as_operand(right));
+    }
+
+    template<class L, class R> requires array_operands<L, R>
+    constexpr auto operator+(const L& left, const R& right){ return make_binary<std::plus<>>(left, right); }
+    template<class L, class R> requires array_operands<L, R>
+    constexpr auto operator-(const L& left, const R& right){ return make_binary<std::minus<>>(left, right); }
+    template<class L, class R> requires array_operands<L, R>
+    constexpr auto operator*(const L& left, const R& right){ return make_binary<std::multiplies<>>(left, right); }
+    template<class L, class R> requires array_operands<L, R>
+    constexpr auto operator/(const L& left, const R& right){ return make_binary<std::divides<>>(left, right); }
+    template<class E> requires is_array_operand_v<E>
+    constexpr auto operator-(const E& operand){ return unary_expression<std::negate<>, E>(operand); }
+}
+#endif
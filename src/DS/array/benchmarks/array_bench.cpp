@@ -0,0 +1,93 @@
+/* >=====> Aligned and Padded Array Benchmark <=====< */
+//=> 1. Aligned loads: DSA::array<float, N, 64>::sum next to the same array placed 60 bytes into a cache
+//=>    line, so that every other vector load straddles two lines, for N = 2^10 up to 2^max (argv[1],
+//=>    default 16) floats, each summed until 2^28 elements were read.
+//=> 2. False sharing: 1 up to 2 * hardware threads each bump their own counter, stored in a
+//=>    DSA::array (8 counters per cache line) or a DSA::padded_array (one per line).
+//=> Build with: cmake -S . -B build -DCMAKE_BUILD_TYPE=Release -DBUILD_BENCHMARKS=ON (-DENABLE_NATIVE_ARCH=ON for AVX2 loads)
+#include <algorithm>
+#include <chrono>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <fmt/core.h>
+#include <array.hpp>
+#include <padded_array.hpp>
+
+constexpr size_t READS = size_t(1) << 28; //=> elements summed per size
+constexpr size_t INCREMENTS = size_t(1) << 24; //=> per thread
+constexpr size_t MAX_THREADS = 64;
+
+template<size_t N>
+struct alignas(64) straddling { //=> the array starts 4 bytes before the end of a cache line
+  char padding[60];
+  DSA::array<float, N> values;
+};
+
+template<class Array>
+double time_sum(const Array& values, size_t n, float& checksum){ //=> nanoseconds per 1000 elements
+  size_t rounds = READS / n;
+  auto start = std::chrono::steady_clock::now();
+  for(size_t r = 0; r < rounds; r++){
+    float total = values.sum();
+    asm volatile("" : : "g"(&total) : "memory"); //=> keep every round
+    checksum += total;
+  }
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(stop - start).count() * 1000.0 / double(rounds * n);
+}
+
+template<size_t LOG>
+void bench_loads(size_t max_log){
+  if constexpr (LOG <= 20){
+    if(LOG > max_log){ return; }
+    constexpr size_t N = size_t(1) << LOG;
+    auto aligned = std::make_unique<DSA::array<float, N, 64>>();
+    auto shifted = std::make_unique<straddling<N>>();
+    for(size_t i = 0; i < N; i++){ (*aligned)[i] = shifted->values[i] = float(i % 7); }
+    float checksum = 0;
+    double fast = time_sum(*aligned, N, checksum), slow = time_sum(shifted->values, N, checksum);
+    fmt::print("{:>10} | {:>14.1f} ns | {:>14.1f} ns   (checksum {})\n", N, fast, slow, checksum);
+    bench_loads<LOG + 1>(max_log);
+  }
+}
+
+template<class Counters>
+double time_counters(Counters& counters, size_t threads){ //=> million increments per second, all threads together
+  std::vector<std::thread> workers;
+  auto start = std::chrono::steady_clock::now();
+  for(size_t t = 0; t < threads; t++){
+    workers.emplace_back([&counters, t]{
+      std::atomic<std::uint64_t>& counter = counters[t];
+      for(size_t i = 0; i < INCREMENTS; i++){ //=> only this thread writes it: no read-modify-write needed
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+      }
+    });
+  }
+  for(std::thread& worker : workers){ worker.join(); }
+  auto stop = std::chrono::steady_clock::now();
+  return double(threads * INCREMENTS) / std::chrono::duration<double, std::micro>(stop - start).count();
+}
+
+int main(int argc, char** argv){
+  size_t max_log = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 16;
+
+  fmt::print("{:>10} | {:>17} | {:>17}\n", "floats", "aligned (64)", "straddling");
+  bench_loads<10>(max_log);
+
+  size_t max_threads = std::min<size_t>(MAX_THREADS, 2 * std::max(1u, std::thread::hardware_concurrency()));
+  fmt::print("\n{:>10} | {:>17} | {:>17}\n", "threads", "array", "padded_array");
+  for(size_t threads = 1; threads <= max_threads; threads *= 2){
+    DSA::array<std::atomic<std::uint64_t>, MAX_THREADS> packed;
+    DSA::padded_array<std::atomic<std::uint64_t>, MAX_THREADS> padded;
+    double slow = time_counters(packed, threads), fast = time_counters(padded, threads);
+    std::uint64_t checksum = 0;
+    for(size_t t = 0; t < threads; t++){ checksum += packed[t].load() + padded[t].load(); }
+    fmt::print("{:>10} | {:>11.1f} Mop/s | {:>11.1f} Mop/s   (checksum {})\n", threads, slow, fast, checksum);
+  }
+  return 0;
+}
@@ -0,0 +1,60 @@
+/* >=====> Multidimensional Array Benchmark <=====< */
+//=> An n x n matrix of doubles, n = 2^max (argv[1], default 12): stored as std::vector<std::vector<double>>
+//=> and as DSA::mdarray in row-major, column-major and 8 x 8 tiled layouts. Times a sum down the columns,
+//=> a naive transpose (two nested loops) and DSA::transpose (cache-oblivious blocks). A power-of-two n
+//=> is the worst case for the column walks: every row maps to the same cache sets.
+//=> Build with: cmake -S . -B build -DCMAKE_BUILD_TYPE=Release -DBUILD_BENCHMARKS=ON
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include <fmt/core.h>
+#include <mdarray.hpp>
+
+template<class Pass>
+double time_once(Pass pass, double& checksum){ //=> milliseconds
+  auto start = std::chrono::steady_clock::now();
+  checksum += pass();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+template<class Matrix>
+double column_sum(const Matrix& m, size_t n){ //=> j outer, i inner: a column walk
+  double total = 0;
+  for(size_t j = 0; j < n; j++){ for(size_t i = 0; i < n; i++){ total += m(i, j); } }
+  return total;
+}
+
+template<class Layout>
+void rows(const char* name, const DSA::mdarray<double, 2, Layout>& matrix, double& checksum){
+  size_t n = matrix.extent(0);
+  double sum = time_once([&]{ return column_sum(matrix, n); }, checksum);
+  DSA::mdarray<double, 2, Layout> out(n, n);
+  double naive = time_once([&]{
+    for(size_t i = 0; i < n; i++){ for(size_t j = 0; j < n; j++){ out(j, i) = matrix(i, j); } }
+    return out(1, 0);
+  }, checksum);
+  double blocked = time_once([&]{ DSA::transpose(matrix.view(), out.view()); return out(0, 1); }, checksum);
+  fmt::print("{:>22} | {:>10.2f} ms | {:>10.2f} ms | {:>10.2f} ms   (checksum {:.0f})\n", name, sum, naive, blocked, checksum);
+}
+
+int main(int argc, char** argv){
+  size_t n = size_t(1) << ((argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 12);
+  std::mt19937_64 random(42);
+  DSA::mdarray<double, 2> row_major(n, n);
+  for(size_t i = 0; i < n; i++){ for(size_t j = 0; j < n; j++){ row_major(i, j) = double(random() % 1000); } }
+  std::vector<std::vector<double>> nested(n, std::vector<double>(n));
+  for(size_t i = 0; i < n; i++){ for(size_t j = 0; j < n; j++){ nested[i][j] = row_major(i, j); } }
+
+  double checksum = 0;
+  fmt::print("{:>22} | {:>13} | {:>13} | {:>13}\n", "storage", "column sum", "naive T", "DSA::transpose");
+  double sum = time_once([&]{ double total = 0; for(size_t j = 0; j < n; j++){ for(size_t i = 0; i < n; i++){ total += nested[i][j]; } } return total; }, checksum);
+  std::vector<std::vector<double>> flipped(n, std::vector<double>(n));
+  double naive = time_once([&]{ for(size_t i = 0; i < n; i++){ for(size_t j = 0; j < n; j++){ flipped[j][i] = nested[i][j]; } } return flipped[1][0]; }, checksum);
+  fmt::print("{:>22} | {:>10.2f} ms | {:>10.2f} ms | {:>13}   (checksum {:.0f})\n", "vector<vector<double>>", sum, naive, "-", checksum);
+  rows("row-major", row_major, checksum);
+  rows("column-major", DSA::mdarray<double, 2, DSA::layout_left>(row_major), checksum);
+  rows("tiled 8 x 8", DSA::mdarray<double, 2, DSA::layout_tiled<8>>(row_major), checksum);
+  return 0;
+}
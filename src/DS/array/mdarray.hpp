@@ -0,0 +1,364 @@
+#ifndef MDARRAY_HPP
+#define MDARRAY_HPP
+
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#if __has_include(<mdspan>)
+  #include <mdspan>
+#endif
+#include "array.hpp"
+#include <DS/vector/vector.hpp> //=> for DSA::vector, the storage
+
+namespace DSA{
+    template<size_t Rank>
+    using md_index = array<size_t, Rank>; //the extents of a shape, or the indices of one element
+
+    namespace mdarray_detail{
+        constexpr size_t LEAF = 16; //the cache-oblivious recursion stops at LEAF x LEAF blocks
+
+        template<size_t Rank>
+        class shape { //the extents every layout mapping carries
+            static_assert(Rank > 0, "Error: Rank must be at least 1!");
+            protected:
+                md_index<Rank> sizes{};
+            public:
+                constexpr shape() = default;
+                constexpr explicit shape(const md_index<Rank>& extents) : sizes(extents) {}
+                constexpr const md_index<Rank>& extents(void) const noexcept { return this->sizes; }
+                constexpr size_t extent(size_t r) const noexcept { return this->sizes[r]; }
+                constexpr size_t size(void) const noexcept { //number of elements
+                    size_t total = 1;
+                    for(size_t r = 0; r < Rank; r++){ total *= this->sizes[r]; }
+                    return total;
+                }
+                static constexpr size_t rank(void) noexcept { return Rank; }
+        };
+
+        //=> Splits the [row0, row1) x [col0, col1) block along its longer side until it is at most LEAF x LEAF,
+        //=> then hands it to leaf. Whatever the cache sizes, some level of the recursion fits in each of them.
+        template<class Leaf>
+        void blocked(size_t row0, size_t row1, size_t col0, size_t col1, Leaf& leaf){
+            size_t rows = row1 - row0, cols = col1 - col0;
+            if(rows <= LEAF && cols <= LEAF){ leaf(row0, row1, col0, col1); return; }
+            if(rows >= cols){
+                size_t middle = row0 + rows / 2;
+                blocked(row0, middle, col0, col1, leaf);
+                blocked(middle, row1, col0, col1, leaf);
+            }
+            else {
+                size_t middle = col0 + cols / 2;
+                blocked(row0, row1, col0, middle, leaf);
+                blocked(row0, row1, middle, col1, leaf);
+            }
+        }
+
+        template<size_t Rank, class Function>
+        void for_each_outer(const md_index<Rank>& extents, Function&& function){ //every index of the dimensions before the last two
+            md_index<Rank> index{};
+            for(size_t r = 0; r < Rank; r++){ if(extents[r] == 0){ return; } }
+            for(;;){
+                function(index);
+                for(size_t r = Rank - 2; ; ){ //an odometer over dimensions 0 .. Rank - 3
+                    if(r == 0){ return; }
+                    --r;
+                    if(++index[r] < extents[r]){ break; }
+                    index[r] = 0;
+                }
+            }
+        }
+    }
+
+    /* >=====> Layouts <=====< */
+    //=> A layout turns the indices of an element into its offset in the storage. Like the std::mdspan layout
+    //=> policies, each has a nested mapping for a given rank, with extents(), required_span_size(), stride(r)
+    //=> when the layout is strided, and is_always_unique/exhaustive/strided().
+
+    struct layout_right { //row-major: the last index is contiguous (C arrays, std::layout_right)
+        template<size_t Rank>
+        class mapping : public mdarray_detail::shape<Rank> {
+            public:
+                using mdarray_detail::shape<Rank>::shape;
+                constexpr size_t offset(const size_t* index) const noexcept {
+                    size_t result = 0;
+                    for(size_t r = 0; r < Rank; r++){ result = result * this->sizes[r] + index[r]; }
+                    return result;
+                }
+                constexpr size_t stride(size_t r) const noexcept {
+                    size_t result = 1;
+                    for(size_t s = r + 1; s < Rank; s++){ result *= this->sizes[s]; }
+                    return result;
+                }
+                constexpr size_t required_span_size(void) const noexcept { return this->size(); }
+                static constexpr bool is_always_unique(void) noexcept { return true; }
+                static constexpr bool is_always_exhaustive(void) noexcept { return true; }
+                static constexpr bool is_always_strided(void) noexcept { return true; }
+        };
+    };
+
+    struct layout_left { //column-major: the first index is contiguous (Fortran, BLAS, std::layout_left)
+        template<size_t Rank>
+        class mapping : public mdarray_detail::shape<Rank> {
+            public:
+                using mdarray_detail::shape<Rank>::shape;
+                constexpr size_t offset(const size_t* index) const noexcept {
+                    size_t result = 0;
+                    for(size_t r = Rank; r-- > 0; ){ result = result * this->sizes[r] + index[r]; }
+                    return result;
+                }
+                constexpr size_t stride(size_t r) const noexcept {
+                    size_t result = 1;
+                    for(size_t s = 0; s < r; s++){ result *= this->sizes[s]; }
+                    return result;
+                }
+                constexpr size_t required_span_size(void) const noexcept { return this->size(); }
+                static constexpr bool is_always_unique(void) noexcept { return true; }
+                static constexpr bool is_always_exhaustive(void) noexcept { return true; }
+                static constexpr bool is_always_strided(void) noexcept { return true; }
+        };
+    };
+
+    //=> The last two dimensions are cut into Tile x Tile blocks, each stored contiguously (row-major inside,
+    //=> blocks row-major too), the leading dimensions are row-major over whole matrices. A block of 8 x 8
+    //=> doubles is 8 cache lines, one per tile row, so walking down a column still touches a new line per
+    //=> row; the gain is that those 8 lines are adjacent (one 512-byte block the prefetcher streams) and
+    //=> are reused by the next 7 columns of the tile, where row-major layout spreads them a whole row apart.
+    //=> Rows and columns are padded up to a multiple of Tile, so the layout is not exhaustive.
+    template<size_t Tile = 8>
+    struct layout_tiled {
+        static_assert(Tile > 0 && (Tile & (Tile - 1)) == 0, "Error: Tile size must be a power of two!");
+        template<size_t Rank>
+        class mapping : public mdarray_detail::shape<Rank> {
+            static_assert(Rank >= 2, "Error: Tiles need at least 2 dimensions!");
+            private:
+                static constexpr size_t padded(size_t extent) noexcept { return (extent + Tile - 1) / Tile * Tile; }
+            public:
+                using mdarray_detail::shape<Rank>::shape;
+                constexpr size_t offset(const size_t* index) const noexcept {
+                    size_t outer = 0;
+                    for(size_t r = 0; r + 2 < Rank; r++){ outer = outer * this->sizes[r] + index[r]; }
+                    size_t row = index[Rank - 2], column = index[Rank - 1];
+                    size_t tiles_per_row = padded(this->sizes[Rank - 1]) / Tile;
+                    size_t tile = (row / Tile) * tiles_per_row + column / Tile;
+                    return outer * this->matrix_span() + tile * Tile * Tile + (row % Tile) * Tile + column % Tile;
+                }
+                constexpr size_t matrix_span(void) const noexcept { return padded(this->sizes[Rank - 2]) * padded(this->sizes[Rank - 1]); } //one padded matrix
+                constexpr size_t required_span_size(void) const noexcept {
+                    size_t outer = 1;
+                    for(size_t r = 0; r + 2 < Rank; r++){ outer *= this->sizes[r]; }
+                    return outer * this->matrix_span();
+                }
+                static constexpr bool is_always_unique(void) noexcept { return true; }
+                static constexpr bool is_always_exhaustive(void) noexcept { return false; }
+                static constexpr bool is_always_strided(void) noexcept { return false; }
+        };
+    };
+
+    /* >=====> Multidimensional Span <=====< */
+    //=> A non-owning view of Rank-dimensional data through a layout, shaped after std::mdspan (C++23):
+    //=> v(i, j, ...), extent(r), size(), data_handle(), mapping(), stride(r). When the standard library has
+    //=> <mdspan>, to_std() turns a row- or column-major view into the std::mdspan of the same data.
+    template<class T, size_t Rank, class Layout = layout_right>
+    class mdspan {
+        public:
+            using element_type = T;
+            using layout_type = Layout;
+            using mapping_type = typename Layout::template mapping<Rank>;
+        private:
+            T* pointer = nullptr;
+            mapping_type map;
+        public:
+            /*assigning*/
+            constexpr mdspan() = default; //declaration (empty)
+            constexpr mdspan(T* data, const mapping_type& map) noexcept : pointer(data), map(map) {}
+            template<class... I> requires (sizeof...(I) == Rank && (std::is_convertible_v<I, size_t> && ...))
+            constexpr mdspan(T* data, I... extents) : pointer(data), map(md_index<Rank>{size_t(extents)...}) {}
+            template<class U> requires std::is_same_v<const U, T>
+            constexpr mdspan(const mdspan<U, Rank, Layout>& other) noexcept : pointer(other.data_handle()), map(other.mapping()) {} //adding const
+
+            //accessing || O(Rank)
+            template<class... I> requires (sizeof...(I) == Rank)
+            constexpr T& operator()(I... indices) const noexcept { //v(i, j, ...)
+                const size_t index[Rank] = {size_t(indices)...};
+                return this->pointer[this->map.offset(index)];
+            }
+            constexpr T& operator()(const md_index<Rank>& index) const noexcept { return this->pointer[this->map.offset(index.data())]; }
+
+            constexpr T* data_handle(void) const noexcept { return this->pointer; }
+            constexpr const mapping_type& mapping(void) const noexcept { return this->map; }
+
+            //size and shape
+            static constexpr size_t rank(void) noexcept { return Rank; }
+            constexpr const md_index<Rank>& extents(void) const noexcept { return this->map.extents(); }
+            constexpr size_t extent(size_t r) const noexcept { return this->map.extent(r); }
+            constexpr size_t size(void) const noexcept { return this->map.size(); }
+            constexpr bool empty(void) const noexcept { return this->map.size() == 0; }
+            constexpr size_t stride(size_t r) const noexcept requires (mapping_type::is_always_strided()) { return this->map.stride(r); }
+            static constexpr bool is_always_unique(void) noexcept { return mapping_type::is_always_unique(); }
+            static constexpr bool is_always_exhaustive(void) noexcept { return mapping_type::is_always_exhaustive(); }
+            static constexpr bool is_always_strided(void) noexcept { return mapping_type::is_always_strided(); }
+
+#if defined(__cpp_lib_mdspan)
+            auto to_std(void) const requires (std::is_same_v<Layout, layout_right> || std::is_same_v<Layout, layout_left>) {
+                using std_layout = std::conditional_t<std::is_same_v<Layout, layout_right>, std::layout_right, std::layout_left>;
+                return [this]<size_t... R>(std::index_sequence<R...>){
+                    return std::mdspan<T, std::dextents<size_t, Rank>, std_layout>(this->pointer, this->extent(R)...);
+                }(std::make_index_sequence<Rank>{});
+            }
+#endif
+    };
+
+    /* >=====> Multidimensional Array <=====< */
+    //=> An owning Rank-dimensional array in one contiguous, 64-byte aligned block (a DSA::vector): one
+    //=> allocation instead of one per row as with std::vector<std::vector<T>>, and a column walk is a
+    //=> constant stride instead of a pointer chase per row. Layout picks row-major (layout_right, the
+    //=> default), column-major (layout_left) or tiled (layout_tiled<8>) storage; view() is an mdspan of it.
+    //=> Constructing from an mdarray of another layout converts it with DSA::copy.
+    template<class T, size_t Rank, class Layout = layout_right>
+    class mdarray {
+        public:
+            using element_type = T;
+            using layout_type = Layout;
+            using mapping_type = typename Layout::template mapping<Rank>;
+            using view_type = mdspan<T, Rank, Layout>;
+            using const_view_type = mdspan<const T, Rank, Layout>;
+            static constexpr size_t ALIGNMENT = 64; //a cache line
+        private:
+            mapping_type map;
+            vector<T, aligned_allocator<ALIGNMENT>> elements;
+        public:
+            /*assigning*/
+            mdarray() = default; //declaration (no elements)
+            explicit mdarray(const md_index<Rank>& extents) : map(extents) { //value-initialized elements
+                this->elements.reserve_exact(this->map.required_span_size());
+                this->elements.resize(this->map.required_span_size());
+            }
+            template<class... I> requires (sizeof...(I) == Rank && (std::is_convertible_v<I, size_t> && ...))
+            explicit mdarray(I... extents) : mdarray(md_index<Rank>{size_t(extents)...}) {}
+            template<class Other> requires (!std::is_same_v<Other, Layout>)
+            explicit mdarray(const mdarray<T, Rank, Other>& other); //changing the layout, O(n)
+            mdarray(const mdarray& other) = default; //copying
+            mdarray(mdarray&& other) noexcept = default; //moving
+            mdarray& operator=(const mdarray& other) = default;
+            mdarray& operator=(mdarray&& other) noexcept = default;
+            ~mdarray() = default; //destructor
+
+            //accessing || O(Rank)
+            template<class... I> requires (sizeof...(I) == Rank)
+            T& operator()(I... indices) noexcept { //a(i, j, ...)
+                const size_t index[Rank] = {size_t(indices)...};
+                return this->elements.data()[this->map.offset(index)];
+            }
+            template<class... I> requires (sizeof...(I) == Rank)
+            const T& operator()(I... indices) const noexcept { //a(i, j, ...)
+                const size_t index[Rank] = {size_t(indices)...};
+                return this->elements.data()[this->map.offset(index)];
+            }
+            T& operator()(const md_index<Rank>& index) noexcept { return this->elements.data()[this->map.offset(index.data())]; }
+            const T& operator()(const md_index<Rank>& index) const noexcept { return this->elements.data()[this->map.offset(index.data())]; }
+
+            template<class... I> requires (sizeof...(I) == Rank)
+            T& at(I... indices){ // access by a function with an exception
+                const size_t index[Rank] = {size_t(indices)...};
+                for(size_t r = 0; r < Rank; r++){ if(index[r] >= this->map.extent(r)){ throw std::out_of_range("Error: Index is out of range!"); } }
+                return this->elements.data()[this->map.offset(index)];
+            }
+            template<class... I> requires (sizeof...(I) == Rank)
+            const T& at(I... indices) const { // access by a function with an exception
+                const size_t index[Rank] = {size_t(indices)...};
+                for(size_t r = 0; r < Rank; r++){ if(index[r] >= this->map.extent(r)){ throw std::out_of_range("Error: Index is out of range!"); } }
+                return this->elements.data()[this->map.offset(index)];
+            }
+
+            view_type view(void) noexcept { return view_type(this->elements.data(), this->map); } //an mdspan of the elements
+            const_view_type view(void) const noexcept { return const_view_type(this->elements.data(), this->map); } //an mdspan of the elements
+            T* data(void) noexcept { return this->elements.data(); } //the storage, in layout order
+            const T* data(void) const noexcept { return this->elements.data(); } //the storage, in layout order
+            const mapping_type& mapping(void) const noexcept { return this->map; }
+
+            //size and shape
+            static constexpr size_t rank(void) noexcept { return Rank; }
+            const md_index<Rank>& extents(void) const noexcept { return this->map.extents(); }
+            size_t extent(size_t r) const noexcept { return this->map.extent(r); }
+            size_t size(void) const noexcept { return this->map.size(); } //elements, without the padding of a tiled layout
+            bool empty(void) const noexcept { return this->map.size() == 0; }
+            size_t span_size(void) const noexcept { return this->map.required_span_size(); } //elements stored, with the padding
+
+            //operations
+            void fill(const T& value){ std::fill(this->elements.begin(), this->elements.end(), value); }
+            void swap(mdarray& other) noexcept {
+                std::swap(this->map, other.map);
+                this->elements.swap(other.elements);
+            }
+
+            template<class Other> //O(n), same extents and same elements, whatever the layouts
+            friend bool operator==(const mdarray& left, const mdarray<T, Rank, Other>& right){
+                if(!(left.extents() == right.extents())){ return false; }
+                if constexpr (std::is_same_v<Other, Layout>){ return left.elements == right.elements; }
+                else {
+                    bool equal = true;
+                    auto from = left.view();
+                    auto to = right.view();
+                    if constexpr (Rank == 1){ for(size_t i = 0; i < left.extent(0); i++){ equal = equal && from(i) == to(i); } }
+                    else {
+                        mdarray_detail::for_each_outer(left.extents(), [&](md_index<Rank> index){
+                            for(size_t i = 0; i < left.extent(Rank - 2); i++){
+                                index[Rank - 2] = i;
+                                for(size_t j = 0; j < left.extent(Rank - 1); j++){ index[Rank - 1] = j; equal = equal && from(index) == to(index); }
+                            }
+                        });
+                    }
+                    return equal;
+                }
+            }
+    };
+
+    /* >=====> Copy & Transpose <=====< */
+    //=> copy(from, to) copies between views of the same extents and any two layouts: the same layout is one
+    //=> straight copy of the storage, otherwise the last two dimensions are walked in cache-oblivious blocks
+    //=> (halved along the longer side down to 16 x 16), so that both the reads and the writes stay in cache.
+    //=> transpose(from, to) writes to(j, i) = from(i, j) with the same recursion.
+    template<class T, class U, size_t Rank, class From, class To>
+    void copy(const mdspan<T, Rank, From>& from, const mdspan<U, Rank, To>& to){ //O(n)
+        if(!(from.extents() == to.extents())){ throw std::invalid_argument("Error: Extents do not match!"); }
+        if constexpr (std::is_same_v<From, To> && std::is_same_v<std::remove_const_t<T>, U>){
+            std::copy(from.data_handle(), from.data_handle() + from.mapping().required_span_size(), to.data_handle());
+        }
+        else if constexpr (Rank == 1){ for(size_t i = 0; i < from.extent(0); i++){ to(i) = from(i); } }
+        else {
+            mdarray_detail::for_each_outer(from.extents(), [&from, &to](md_index<Rank> index){
+                auto leaf = [&from, &to, &index](size_t row0, size_t row1, size_t col0, size_t col1){
+                    for(size_t i = row0; i < row1; i++){
+                        index[Rank - 2] = i;
+                        for(size_t j = col0; j < col1; j++){ index[Rank - 1] = j; to(index) = from(index); }
+                    }
+                };
+                mdarray_detail::blocked(0, from.extent(Rank - 2), 0, from.extent(Rank - 1), leaf);
+            });
+        }
+    }
+
+    template<class T, class U, class From, class To>
+    void transpose(const mdspan<T, 2, From>& from, const mdspan<U, 2, To>& to){ //O(n), to must be extent(1) x extent(0)
+        if(from.extent(0) != to.extent(1) || from.extent(1) != to.extent(0)){ throw std::invalid_argument("Error: Extents do not match!"); }
+        auto leaf = [&from, &to](size_t row0, size_t row1, size_t col0, size_t col1){
+            for(size_t i = row0; i < row1; i++){
+                for(size_t j = col0; j < col1; j++){ to(j, i) = from(i, j); }
+            }
+        };
+        mdarray_detail::blocked(0, from.extent(0), 0, from.extent(1), leaf);
+    }
+
+    template<class T, class Layout>
+    mdarray<T, 2, Layout> transpose(const mdarray<T, 2, Layout>& matrix){ //a new extent(1) x extent(0) array, same layout
+        mdarray<T, 2, Layout> result(matrix.extent(1), matrix.extent(0));
+        transpose(matrix.view(), result.view());
+        return result;
+    }
+
+    template<class T, size_t Rank, class Layout>
+    template<class Other> requires (!std::is_same_v<Other, Layout>)
+    mdarray<T, Rank, Layout>::mdarray(const mdarray<T, Rank, Other>& other) : mdarray(other.extents()) { copy(other.view(), this->view()); }
+}
+#endif
@@ -0,0 +1,197 @@
+#ifndef PACKED_ARRAY_HPP
+#define PACKED_ARRAY_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#if defined(__AVX2__)
+  #include <immintrin.h>
+#endif
+
+namespace DSA{
+    using size_t = long unsigned int;
+
+    /* >=====> Packed Array <=====< */
+    //=> N unsigned integers of Bits bits each, stored back to back in 64-bit words: a million values in
+    //=> 0..4095 take 1.5 MB instead of the 4 MB of an int array. Bits = 0 picks the width at run time.
+    //=> get/set are branch-free two-word reads and writes (a value may straddle two words, the array
+    //=> keeps one spare word so that the second one always exists). unpack decodes a run into a plain
+    //=> array (AVX2: 8 values per gather up to 25 bits), pack encodes one with a streaming shift-or, and
+    //=> the iterators decode sequentially without multiplying. counting::counting_sort and
+    //=> counting::radix_sort sort a packed array in place.
+    template<size_t Bits = 0>
+    class packed_array {
+        static_assert(Bits <= 64, "Error: Width must be at most 64 bits!");
+        private:
+            std::uint64_t* words = nullptr;
+            size_t count = 0;
+            unsigned bits = Bits; //the run-time width, equal to Bits when that is fixed
+
+            static constexpr size_t word_count(size_t N, unsigned width) noexcept { return (N * width + 63) / 64 + 1; } //one spare word
+            static constexpr std::uint64_t mask_of(unsigned width) noexcept { return width == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << width) - 1; }
+            static std::uint64_t read(const std::uint64_t* word, unsigned shift) noexcept { //64 bits starting at bit shift of word[0]
+                return (word[0] >> shift) | ((word[1] << 1) << (63 - shift)); //the double shift is 0 when shift == 0
+            }
+            void allocate(size_t N){
+                this->count = N;
+                this->words = new std::uint64_t[word_count(N, this->width())]();
+            }
+
+        public:
+            using value_type = std::uint64_t;
+
+            class reference { //what operator[] returns: reads and writes one packed value
+                private:
+                    packed_array* array;
+                    size_t index;
+                public:
+                    reference(packed_array* array, size_t index) noexcept : array(array), index(index) {}
+                    operator std::uint64_t() const noexcept { return array->get(index); }
+                    reference& operator=(std::uint64_t value) noexcept { array->set(index, value); return *this; }
+                    reference& operator=(const reference& other) noexcept { return *this = std::uint64_t(other); }
+            };
+
+            class const_iterator { //sequential decoder: advances a word pointer and a shift
+                private:
+                    const std::uint64_t* word = nullptr;
+                    unsigned shift = 0, width = 0;
+                    size_t index = 0;
+                public:
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type = std::uint64_t;
+                    using difference_type = std::ptrdiff_t;
+                    const_iterator() = default;
+                    const_iterator(const std::uint64_t* words, unsigned width, size_t index) noexcept
+                        : word(words + index * width / 64), shift(unsigned(index * width % 64)), width(width), index(index) {}
+                    std::uint64_t operator*() const noexcept { return read(word, shift) & mask_of(width); }
+                    const_iterator& operator++() noexcept {
+                        shift += width;
+                        word += shift / 64;
+                        shift %= 64;
+                        ++index;
+                        return *this;
+                    }
+                    const_iterator operator++(int) noexcept { const_iterator old = *this; ++*this; return old; }
+                    friend bool operator==(const const_iterator& left, const const_iterator& right) noexcept { return left.index == right.index; }
+            };
+
+            /*assigning*/
+            packed_array() = default; //declaration (with Bits = 0, width 0 until assigned)
+            explicit packed_array(size_t N) requires (Bits != 0) { this->allocate(N); } //N zeros
+            packed_array(size_t N, unsigned width) requires (Bits == 0) : bits(width) { //N zeros of width bits
+                if(width == 0 || width > 64){ throw std::invalid_argument("Error: Width must be 1 to 64 bits!"); }
+                this->allocate(N);
+            }
+            packed_array(std::initializer_list<std::uint64_t> list) requires (Bits != 0) { //assigning with a list
+                this->allocate(list.size());
+                this->pack(0, list.size(), list.begin());
+            }
+            packed_array(const packed_array& other) : bits(other.bits) { //copying
+                if(other.words == nullptr){ return; }
+                this->allocate(other.count);
+                std::memcpy(this->words, other.words, word_count(other.count, other.width()) * sizeof(std::uint64_t));
+            }
+            packed_array(packed_array&& other) noexcept { this->swap(other); } //moving
+            packed_array& operator=(const packed_array& other){ if(this != &other){ packed_array(other).swap(*this); } return *this; }
+            packed_array& operator=(packed_array&& other) noexcept { packed_array(std::move(other)).swap(*this); return *this; }
+            ~packed_array(){ delete[] this->words; } //destructor
+
+            void swap(packed_array& other) noexcept {
+                std::swap(this->words, other.words);
+                std::swap(this->count, other.count);
+                std::swap(this->bits, other.bits);
+            }
+
+            //accessing || O(1)
+            std::uint64_t get(size_t index) const noexcept { //two loads, two shifts, one mask
+                size_t bit = index * this->width();
+                return read(this->words + bit / 64, unsigned(bit % 64)) & this->mask();
+            }
+            void set(size_t index, std::uint64_t value) noexcept { //value is cut to width bits
+                size_t bit = index * this->width();
+                std::uint64_t* word = this->words + bit / 64;
+                unsigned shift = unsigned(bit % 64);
+                value &= this->mask();
+                word[0] = (word[0] & ~(this->mask() << shift)) | (value << shift);
+                word[1] = (word[1] & ~((this->mask() >> 1) >> (63 - shift))) | ((value >> 1) >> (63 - shift)); //no-op unless the value straddles
+            }
+            std::uint64_t operator[](size_t index) const noexcept { return this->get(index); } //access by []
+            reference operator[](size_t index) noexcept { return reference(this, index); } //access by []
+            std::uint64_t at(size_t index) const { // access by a function with an exception
+                if(index >= this->count){ throw std::out_of_range("Error: Index is out of range!"); }
+                return this->get(index);
+            }
+
+            const_iterator begin(void) const noexcept { return const_iterator(this->words, this->width(), 0); } //decodes from the first value
+            const_iterator end(void) const noexcept { return const_iterator(this->words, this->width(), this->count); } //past the last value
+
+            const std::uint64_t* data(void) const noexcept { return this->words; } //the packed words
+            std::uint64_t* data(void) noexcept { return this->words; } //the packed words
+
+            //size and capacity
+            size_t size(void) const noexcept { return this->count; }
+            bool empty(void) const noexcept { return this->count == 0; }
+            constexpr unsigned width(void) const noexcept { if constexpr (Bits != 0){ return Bits; } else { return this->bits; } } //bits per value
+            std::uint64_t mask(void) const noexcept { return mask_of(this->width()); } //the largest value
+            size_t bytes(void) const noexcept { return word_count(this->count, this->width()) * sizeof(std::uint64_t); } //memory used by the values
+
+            //bulk || O(n)
+            template<class T>
+            void unpack(size_t from, size_t N, T* out) const noexcept { //out[k] = get(from + k)
+                static_assert(std::is_integral_v<T>, "Error: Values unpack to integers!");
+                size_t k = 0;
+#if defined(__AVX2__)
+                if constexpr (sizeof(T) == 4){
+                    if(this->width() <= 25){ //a value and its bit shift fit in 32 bits
+                        const unsigned width = this->width();
+                        const __m256i offsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(int(width)));
+                        const __m256i mask = _mm256_set1_epi32(int(this->mask()));
+                        const char* bytes = reinterpret_cast<const char*>(this->words);
+                        for(; k + 8 <= N; k += 8){
+                            size_t bit = (from + k) * width;
+                            __m256i relative = _mm256_add_epi32(offsets, _mm256_set1_epi32(int(bit % 8))); //bits from the base byte
+                            __m256i loaded = _mm256_i32gather_epi32(reinterpret_cast<const int*>(bytes + bit / 8), _mm256_srli_epi32(relative, 3), 1);
+                            __m256i values = _mm256_and_si256(_mm256_srlv_epi32(loaded, _mm256_and_si256(relative, _mm256_set1_epi32(7))), mask);
+                            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + k), values);
+                        }
+                    }
+                }
+#endif
+                for(const_iterator it(this->words, this->width(), from + k); k < N; ++k, ++it){ out[k] = T(*it); }
+            }
+            template<class T>
+            void pack(size_t from, size_t N, const T* in) noexcept { //set(from + k, in[k]), one store per filled word
+                if(N == 0){ return; }
+                const unsigned width = this->width();
+                const std::uint64_t mask = this->mask();
+                size_t bit = from * width;
+                std::uint64_t* word = this->words + bit / 64;
+                unsigned shift = unsigned(bit % 64);
+                std::uint64_t pending = word[0] & ((std::uint64_t(1) << shift) - 1); //the values before from
+                for(size_t k = 0; k < N; k++){
+                    std::uint64_t value = std::uint64_t(in[k]) & mask;
+                    pending |= value << shift;
+                    shift += width;
+                    if(shift >= 64){ //a word is full
+                        *word++ = pending;
+                        shift -= 64;
+                        pending = shift ? value >> (width - shift) : 0;
+                    }
+                }
+                if(shift){ word[0] = (word[0] & ~((std::uint64_t(1) << shift) - 1)) | pending; } //keeps the values after from + N
+            }
+
+            void fill(std::uint64_t value) noexcept { for(size_t i = 0; i < this->count; i++){ this->set(i, value); } }
+
+            friend bool operator==(const packed_array& left, const packed_array& right) noexcept {
+                if(left.count != right.count || left.width() != right.width()){ return false; }
+                for(size_t i = 0; i < left.count; i++){ if(left.get(i) != right.get(i)){ return false; } }
+                return true;
+            }
+    };
+}
+#endif
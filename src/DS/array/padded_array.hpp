@@ -0,0 +1,113 @@
+#ifndef PADDED_ARRAY_HPP
+#define PADDED_ARRAY_HPP
+
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include "array.hpp"
+
+namespace DSA{
+    /* >=====> Padded Array <=====< */
+    //=> Same interface as DSA::array, but every element sits alone at the start of its own cache line.
+    //=> Meant for per-thread counters and flags: with a plain array, the counters of 8 (or 16) threads share
+    //=> one line and every write by one thread invalidates it in the caches of the others (false sharing).
+    //=> Costs LINE bytes per element and is not contiguous, so there is no data() (iterators step by LINE).
+    //=> LINE is 64 by default; use 128 on CPUs whose adjacent-line prefetcher pulls lines in pairs.
+    template<class T, size_t S, size_t LINE = 64>
+    class padded_array {
+        static_assert(LINE >= alignof(T) && (LINE & (LINE - 1)) == 0, "Error: Line size must be a power of two, at least alignof(T)!");
+        private:
+            struct alignas(LINE) slot { T value; }; //sizeof(slot) is a multiple of LINE
+            slot elements[S ? S : 1];
+
+            template<class U, class Slot>
+            class stride_iterator { //walks the values, one slot at a time
+                private:
+                    Slot* current;
+                public:
+                    using iterator_category = std::random_access_iterator_tag;
+                    using value_type = std::remove_const_t<U>;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = U*;
+                    using reference = U&;
+
+                    constexpr stride_iterator(Slot* current = nullptr) noexcept : current(current) {}
+                    constexpr U& operator*() const noexcept { return current->value; }
+                    constexpr U* operator->() const noexcept { return &current->value; }
+                    constexpr U& operator[](difference_type n) const noexcept { return current[n].value; }
+                    constexpr stride_iterator& operator++() noexcept { ++current; return *this; }
+                    constexpr stride_iterator operator++(int) noexcept { return stride_iterator(current++); }
+                    constexpr stride_iterator& operator--() noexcept { --current; return *this; }
+                    constexpr stride_iterator operator--(int) noexcept { return stride_iterator(current--); }
+                    constexpr stride_iterator& operator+=(difference_type n) noexcept { current += n; return *this; }
+                    constexpr stride_iterator& operator-=(difference_type n) noexcept { current -= n; return *this; }
+                    friend constexpr stride_iterator operator+(stride_iterator it, difference_type n) noexcept { return it += n; }
+                    friend constexpr stride_iterator operator+(difference_type n, stride_iterator it) noexcept { return it += n; }
+                    friend constexpr stride_iterator operator-(stride_iterator it, difference_type n) noexcept { return it -= n; }
+                    friend constexpr difference_type operator-(const stride_iterator& left, const stride_iterator& right) noexcept { return left.current - right.current; }
+                    friend constexpr auto operator<=>(const stride_iterator& left, const stride_iterator& right) noexcept = default;
+            };
+
+        public:
+            using iterator = stride_iterator<T, slot>;
+            using const_iterator = stride_iterator<const T, const slot>;
+
+            /*assigning*/
+            padded_array() = default; //declaration
+            constexpr padded_array(std::initializer_list<T> list) : elements{} { //assigning with a list (the rest is value-initialized)
+                if(list.size() > S) { throw std::out_of_range("Error: Size is exceeded!"); }
+                size_t index = 0;
+                for(const T& element : list){
+                    this->elements[index].value = element;
+                    ++index;
+                }
+            }
+            ~padded_array() = default;//destructor
+
+            //accessing
+            constexpr T& operator[](size_t index) noexcept { return this->elements[index].value; } //access by []
+            constexpr const T& operator[](size_t index) const noexcept { return this->elements[index].value; } //access by []
+
+            constexpr T& at(size_t index){ // access by a function with an exception
+                if(index >= S){ throw std::out_of_range("Error: Index is out of range!"); }
+                return this->elements[index].value;
+            }
+            constexpr const T& at(size_t index) const { // access by a function with an exception
+                if(index >= S){ throw std::out_of_range("Error: Index is out of range!"); }
+                return this->elements[index].value;
+            }
+
+            constexpr T& front(void) noexcept { return this->elements[0].value; } // access 1st element
+            constexpr const T& front(void) const noexcept { return this->elements[0].value; } // access 1st element
+
+            constexpr T& back(void) noexcept { return this->elements[S - 1].value; } //access last element
+            constexpr const T& back(void) const noexcept { return this->elements[S - 1].value; } //access last element
+
+            constexpr iterator begin(void) noexcept { return iterator(this->elements); } //access the first element
+            constexpr const_iterator begin(void) const noexcept { return const_iterator(this->elements); } //access the first element
+            constexpr const_iterator cbegin(void) const noexcept { return const_iterator(this->elements); } //access the first element
+
+            constexpr iterator end(void) noexcept { return iterator(this->elements + S); } //access past the last element
+            constexpr const_iterator end(void) const noexcept { return const_iterator(this->elements + S); } //access past the last element
+            constexpr const_iterator cend(void) const noexcept { return const_iterator(this->elements + S); } //access past the last element
+
+            //size and capacity
+            constexpr size_t size(void) const noexcept { return S; }
+
+            constexpr size_t max_size(void) const noexcept { return S; }
+
+            constexpr bool empty(void) noexcept { return S == 0; }
+
+            static constexpr size_t stride(void) noexcept { return sizeof(slot); } //bytes between two elements
+
+            //operations
+            constexpr void fill (const T& value){ for(size_t i = 0; i < S; i++){ this->elements[i].value = value; } }
+
+            constexpr T sum(void) const noexcept { //e.g. the total of per-thread counters, read once at the end
+                T total{};
+                for(size_t i = 0; i < S; i++){ total += this->elements[i].value; }
+                return total;
+            }
+    };
+}
+#endif
@@ -0,0 +1,61 @@
+/* >=====> Bitset Benchmark <=====< */
+//=> 2^max (argv[1], default 26) members at 50% density (1% for the scan): DSA::bitset next to
+//=> std::vector<bool> and a byte array, for popcount, intersection (&=) and walking the set bits.
+//=> Build with: cmake -S . -B build -DCMAKE_BUILD_TYPE=Release -DBUILD_BENCHMARKS=ON (-DENABLE_NATIVE_ARCH=ON for AVX2)
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include <fmt/core.h>
+#include <bitset.hpp>
+
+constexpr size_t ROUNDS = 8;
+
+template<class Pass>
+double time_rounds(Pass pass, size_t& checksum){ //=> milliseconds per round
+  auto start = std::chrono::steady_clock::now();
+  for(size_t r = 0; r < ROUNDS; r++){
+    checksum += pass();
+    asm volatile("" : : : "memory"); //=> no reuse of the previous round
+  }
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(stop - start).count() / ROUNDS;
+}
+
+template<class Bits, class VectorBool, class Bytes>
+void row(const char* name, Bits bits, VectorBool vector_bool, Bytes bytes){
+  size_t checksum = 0;
+  double fast = time_rounds(bits, checksum), slow = time_rounds(vector_bool, checksum), plain = time_rounds(bytes, checksum);
+  fmt::print("{:>16} | {:>10.3f} ms | {:>13.3f} ms | {:>10.3f} ms   (checksum {})\n", name, fast, slow, plain, checksum);
+}
+
+int main(int argc, char** argv){
+  size_t n = size_t(1) << ((argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 26);
+  std::mt19937_64 random(42);
+  DSA::bitset a(n), b(n), sparse(n);
+  std::vector<bool> va(n), vb(n), vsparse(n);
+  std::vector<std::uint8_t> ba(n), bb(n), bsparse(n);
+  for(size_t i = 0; i < n; i++){
+    bool x = random() & 1, y = random() & 1, z = random() % 100 == 0;
+    a.set(i, x); b.set(i, y); sparse.set(i, z);
+    va[i] = x; vb[i] = y; vsparse[i] = z;
+    ba[i] = x; bb[i] = y; bsparse[i] = z;
+  }
+
+  fmt::print("{:>16} | {:>13} | {:>16} | {:>13}\n", "operation", "DSA::bitset", "vector<bool>", "byte array");
+  row("popcount",
+      [&]{ return a.count(); },
+      [&]{ return size_t(std::count(va.begin(), va.end(), true)); },
+      [&]{ size_t total = 0; for(std::uint8_t x : ba){ total += x; } return total; });
+  row("intersection",
+      [&]{ a &= b; return a.find_first(); },
+      [&]{ for(size_t i = 0; i < n; i++){ va[i] = va[i] && vb[i]; } return size_t(va[0]); },
+      [&]{ for(size_t i = 0; i < n; i++){ ba[i] &= bb[i]; } return size_t(ba[0]); });
+  row("set bits (1%)",
+      [&]{ size_t total = 0; for(size_t i : sparse){ total += i; } return total; },
+      [&]{ size_t total = 0; for(size_t i = 0; i < n; i++){ if(vsparse[i]){ total += i; } } return total; },
+      [&]{ size_t total = 0; for(size_t i = 0; i < n; i++){ if(bsparse[i]){ total += i; } } return total; });
+  return 0;
+}
@@ -0,0 +1,50 @@
+/* >=====> Rank/Select Bitvector Benchmark <=====< */
+//=> A dense set of IDs (each of 2^log possible IDs present with probability 1/2) for log from 10 up
+//=> to max (argv[1], default 28): average time per membership + index query for binary::binary_search
+//=> over the sorted uint32 IDs and for the rank/select bitvector, then rank1 and select1 alone,
+//=> with the bits spent per ID by each.
+//=> Build with: cmake -S . -B build -DCMAKE_BUILD_TYPE=Release -DBUILD_BENCHMARKS=ON
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+#include <fmt/core.h>
+#include <binary.hpp>
+#include <rank_select.hpp>
+
+template<class Work>
+double measure(size_t count, Work work){
+  auto start = std::chrono::steady_clock::now();
+  work();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(stop - start).count() / count;
+}
+
+int main(int argc, char** argv){
+  size_t max_log = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 28;
+  constexpr size_t Q = 1 << 20; //=> queries per size
+
+  std::mt19937_64 random(42);
+  auto queries = std::make_unique<std::uint32_t[]>(Q);
+
+  fmt::print("{:>12} | {:>14} | {:>14} | {:>10} | {:>10} | {:>12} | {:>12}\n", "universe", "binary_search", "bitvector", "rank1", "select1", "array bits", "bitvector bits");
+  for(size_t log = 10; log <= max_log && log <= 32; log += 2){
+    size_t U = size_t(1) << log;
+    std::vector<std::uint32_t> ids;
+    for(size_t id = 0; id < U; id++){ if(random() & 1){ ids.push_back(std::uint32_t(id)); } }
+    DSA::rank_select_bitvector bits = DSA::rank_select_bitvector::from_sorted(ids.data(), ids.size(), U);
+    for(size_t q = 0; q < Q; q++){ queries[q] = std::uint32_t(random() % U); }
+
+    size_t checksum = 0;
+    double binary = measure(Q, [&]{ for(size_t q = 0; q < Q; q++){ checksum += binary::binary_search(ids.data(), queries[q], ids.size()); } });
+    double succinct = measure(Q, [&]{ for(size_t q = 0; q < Q; q++){ checksum += bits.search(queries[q]); } });
+    double rank = measure(Q, [&]{ for(size_t q = 0; q < Q; q++){ checksum += bits.rank1(queries[q]); } });
+    double select = measure(Q, [&]{ for(size_t q = 0; q < Q; q++){ checksum += bits.select1(queries[q] % ids.size()); } });
+
+    fmt::print("{:>12} | {:>11.1f} ns | {:>11.1f} ns | {:>7.1f} ns | {:>7.1f} ns | {:>12.2f} | {:>14.3f}   (checksum {})\n",
+               U, binary, succinct, rank, select, 32.0, 8.0 * bits.size_in_bytes() / ids.size(), checksum);
+  }
+  return 0;
+}
@@ -0,0 +1,284 @@
+#ifndef BITSET_HPP
+#define BITSET_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#if defined(__AVX2__)
+  #include <immintrin.h>
+#endif
+#include <DS/file/mapped_file.hpp> //=> for DSA::mapped_file
+
+namespace DSA{
+    using size_t = long unsigned int;
+
+    namespace bitset_detail{
+        constexpr std::uint64_t MAGIC = 0x3154455342415344ull; //=> "DSABSET1"
+        constexpr size_t ALIGNMENT = 64, LINE = 8; //=> bytes, words per cache line (two 256-bit lanes)
+
+        struct header { //=> 64 bytes, so the words that follow stay aligned
+            std::uint64_t magic, bits, words, reserved[5];
+        };
+
+        constexpr size_t padded_words(size_t bits) noexcept { return ((bits + 63) / 64 + LINE - 1) / LINE * LINE; } //=> whole cache lines
+
+        inline size_t popcount(const std::uint64_t* words, size_t N) noexcept { //=> N is a multiple of LINE, words 64-byte aligned
+#if defined(__AVX2__)
+            const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+            const __m256i low = _mm256_set1_epi8(0x0F);
+            __m256i total = _mm256_setzero_si256();
+            for(size_t i = 0; i < N; i += 4){ //=> vpshufb counts the ones of each nibble, vpsadbw adds the bytes up per 64-bit lane
+                __m256i v = _mm256_load_si256(reinterpret_cast<const __m256i*>(words + i));
+                __m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, _mm256_and_si256(v, low)),
+                                                 _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(v, 4), low)));
+                total = _mm256_add_epi64(total, _mm256_sad_epu8(counts, _mm256_setzero_si256()));
+            }
+            return size_t(_mm256_extract_epi64(total, 0) + _mm256_extract_epi64(total, 1) + _mm256_extract_epi64(total, 2) + _mm256_extract_epi64(total, 3));
+#else
+            size_t a = 0, b = 0, c = 0, d = 0; //=> independent sums, so that the popcounts overlap
+            for(size_t i = 0; i < N; i += 4){ a += std::popcount(words[i]); b += std::popcount(words[i + 1]); c += std::popcount(words[i + 2]); d += std::popcount(words[i + 3]); }
+            return a + b + c + d;
+#endif
+        }
+
+        enum class operation { AND, OR, XOR, AND_NOT };
+        template<operation OP>
+        inline void combine(std::uint64_t* target, const std::uint64_t* source, size_t N) noexcept { //=> target = target OP source, N is a multiple of LINE
+#if defined(__AVX2__)
+            for(size_t i = 0; i < N; i += 4){
+                __m256i a = _mm256_load_si256(reinterpret_cast<const __m256i*>(target + i)), b = _mm256_load_si256(reinterpret_cast<const __m256i*>(source + i));
+                if constexpr (OP == operation::AND){ a = _mm256_and_si256(a, b); }
+                else if constexpr (OP == operation::OR){ a = _mm256_or_si256(a, b); }
+                else if constexpr (OP == operation::XOR){ a = _mm256_xor_si256(a, b); }
+                else { a = _mm256_andnot_si256(b, a); } //=> ~b & a
+                _mm256_store_si256(reinterpret_cast<__m256i*>(target + i), a);
+            }
+#else
+            for(size_t i = 0; i < N; i++){ //=> vectorized by the compiler
+                if constexpr (OP == operation::AND){ target[i] &= source[i]; }
+                else if constexpr (OP == operation::OR){ target[i] |= source[i]; }
+                else if constexpr (OP == operation::XOR){ target[i] ^= source[i]; }
+                else { target[i] &= ~source[i]; }
+            }
+#endif
+        }
+
+        inline size_t first_nonzero(const std::uint64_t* words, size_t from, size_t N) noexcept { //=> first nonzero word at or after from, N if none
+            for(; from < N && from % 4; from++){ if(words[from]){ return from; } } //=> up to a 256-bit lane
+#if defined(__AVX2__)
+            for(; from < N; from += 4){ //=> skips 256 zero bits per test
+                __m256i v = _mm256_load_si256(reinterpret_cast<const __m256i*>(words + from));
+                if(!_mm256_testz_si256(v, v)){ break; }
+            }
+#endif
+            for(; from < N; from++){ if(words[from]){ return from; } }
+            return N;
+        }
+    }
+
+    /* >=====> Bitset View <=====< */
+    //=> The read-only half of DSA::bitset, non-owning like std::string_view: it points into a DSA::bitset
+    //=> or into a file saved by save() and mapped with DSA::mapped_file, whose pages are then used in
+    //=> place (the bitset or mapped_file must outlive the view). Both start with the same 64-byte header.
+    class bitset_view {
+        protected:
+            const bitset_detail::header* info = nullptr; //the words follow it
+            const std::uint64_t* words = nullptr; //padded with zero words to whole cache lines
+            size_t bits = 0;
+
+            void attach(const bitset_detail::header* h) noexcept {
+                info = h;
+                words = reinterpret_cast<const std::uint64_t*>(h + 1);
+                bits = h->bits;
+            }
+
+        public:
+            static constexpr size_t npos = size_t(-1);
+
+            class iterator { //walks the set bits: count-trailing-zeros, then clear the lowest one
+                private:
+                    const std::uint64_t* words = nullptr;
+                    size_t word = 0, count = 0;
+                    std::uint64_t current = 0;
+                    void settle(size_t from) noexcept { //to the first nonzero word at or after from
+                        word = bitset_detail::first_nonzero(words, from, count);
+                        current = word < count ? words[word] : 0;
+                    }
+                public:
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type = size_t;
+                    using difference_type = std::ptrdiff_t;
+                    iterator() = default;
+                    iterator(const std::uint64_t* words, size_t count, size_t from) noexcept : words(words), count(count) { settle(from); }
+                    size_t operator*() const noexcept { return word * 64 + std::countr_zero(current); }
+                    iterator& operator++() noexcept {
+                        current &= current - 1;
+                        if(current == 0){ settle(word + 1); }
+                        return *this;
+                    }
+                    iterator operator++(int) noexcept { iterator old = *this; ++*this; return old; }
+                    friend bool operator==(const iterator& left, const iterator& right) noexcept { return left.word == right.word && left.current == right.current; }
+            };
+
+            /*assigning*/
+            bitset_view() = default;
+            explicit bitset_view(const mapped_file& file){ //a saved bitset, O(1)
+                if(file.size() < sizeof(bitset_detail::header) || file.as<bitset_detail::header>()->magic != bitset_detail::MAGIC){ throw std::runtime_error("Error: Not a bitset file!"); }
+                const bitset_detail::header* h = file.as<bitset_detail::header>();
+                if(h->words != bitset_detail::padded_words(h->bits) || file.size() < sizeof(bitset_detail::header) + h->words * sizeof(std::uint64_t)){ throw std::runtime_error("Error: Bitset file is truncated!"); }
+                attach(h);
+            }
+
+            //accessing || O(1)
+            bool operator[](size_t i) const noexcept { return words[i / 64] >> (i % 64) & 1; }
+            bool test(size_t i) const { // access by a function with an exception
+                if(i >= bits){ throw std::out_of_range("Error: Index is out of range!"); }
+                return (*this)[i];
+            }
+            const std::uint64_t* data(void) const noexcept { return words; } //bit i = word i / 64, bit i % 64
+
+            //size
+            size_t size(void) const noexcept { return bits; }
+            size_t word_count(void) const noexcept { return bitset_detail::padded_words(bits); } //including the padding
+            bool empty(void) const noexcept { return bits == 0; }
+
+            //scans || O(n / 64)
+            size_t count(void) const noexcept { return bitset_detail::popcount(words, word_count()); } //number of set bits
+            bool any(void) const noexcept { return find_first() != npos; }
+            bool none(void) const noexcept { return !any(); }
+            bool all(void) const noexcept { return count() == bits; }
+
+            size_t find_first(void) const noexcept { //first set bit, npos if none
+                size_t w = bitset_detail::first_nonzero(words, 0, word_count());
+                return w < word_count() ? w * 64 + std::countr_zero(words[w]) : npos;
+            }
+            size_t find_next(size_t i) const noexcept { //first set bit after i, npos if none
+                if(++i >= bits){ return npos; }
+                std::uint64_t rest = words[i / 64] & (~std::uint64_t(0) << (i % 64));
+                if(rest){ return i / 64 * 64 + std::countr_zero(rest); }
+                size_t w = bitset_detail::first_nonzero(words, i / 64 + 1, word_count());
+                return w < word_count() ? w * 64 + std::countr_zero(words[w]) : npos;
+            }
+
+            iterator begin(void) const noexcept { return iterator(words, word_count(), 0); } //the set bits, in order
+            iterator end(void) const noexcept { return iterator(words, word_count(), word_count()); }
+
+            template<class Function>
+            void for_each(Function function) const { //function(i) for every set bit i, in order
+                for(size_t w = 0, N = word_count(); w < N; w++){
+                    for(std::uint64_t word = words[w]; word; word &= word - 1){ function(w * 64 + std::countr_zero(word)); }
+                }
+            }
+
+            bool equal(const bitset_view& other) const noexcept { //same size and bits
+                return bits == other.bits && (bits == 0 || std::memcmp(words, other.words, word_count() * sizeof(std::uint64_t)) == 0);
+            }
+            friend bool operator==(const bitset_view& left, const bitset_view& right) noexcept { return left.equal(right); }
+
+            void save(const std::string& path) const { //the header and the words as they are in memory, mappable with bitset_view(mapped_file)
+                if(info == nullptr){ throw std::logic_error("Error: Bitset is empty!"); }
+                mapped_file::write(path, info, sizeof(bitset_detail::header) + word_count() * sizeof(std::uint64_t));
+            }
+    };
+
+    /* >=====> Bitset <=====< */
+    //=> A bitset whose size is chosen at run time: 1 bit per element instead of the byte of a bool array,
+    //=> in 64-byte aligned words padded to whole cache lines, so every bulk loop runs over whole 256-bit
+    //=> lanes with no tail. With AVX2, count() uses the vpshufb nibble popcount, &= |= ^= and and_not()
+    //=> process 256 bits per instruction and find_first/find_next skip 256 zero bits per test.
+    //=> Bits past size() are always zero. save() writes a file that bitset_view(mapped_file) uses in
+    //=> place, and data() can be indexed directly by DSA::rank_select_bitvector.
+    class bitset : public bitset_view {
+        private:
+            bitset_detail::header* owned = nullptr; //header + words, one aligned block (the file format)
+
+            static bitset_detail::header* allocate(size_t bits){
+                size_t bytes = sizeof(bitset_detail::header) + bitset_detail::padded_words(bits) * sizeof(std::uint64_t);
+                bitset_detail::header* block = static_cast<bitset_detail::header*>(::operator new(bytes, std::align_val_t{bitset_detail::ALIGNMENT}));
+                std::memset(static_cast<void*>(block), 0, bytes);
+                *block = bitset_detail::header{bitset_detail::MAGIC, bits, bitset_detail::padded_words(bits), {}};
+                return block;
+            }
+            std::uint64_t* mutable_words(void) noexcept { return const_cast<std::uint64_t*>(this->words); }
+            void trim(void) noexcept { //clears the bits past size()
+                if(this->bits % 64){ mutable_words()[this->bits / 64] &= (std::uint64_t(1) << (this->bits % 64)) - 1; }
+            }
+            void check(const bitset_view& other) const {
+                if(other.size() != this->bits){ throw std::invalid_argument("Error: Sizes do not match!"); }
+            }
+            template<bitset_detail::operation OP>
+            bitset& combine(const bitset_view& other){
+                check(other);
+                bitset_detail::combine<OP>(mutable_words(), other.data(), this->word_count());
+                return *this;
+            }
+
+        public:
+            /*assigning*/
+            bitset() : bitset(0) {}
+            explicit bitset(size_t N, bool value = false) : owned(allocate(N)) { //N bits, all set to value
+                this->attach(owned);
+                if(value){ this->set(); }
+            }
+            explicit bitset(const bitset_view& other) : bitset(other.size()) { //copies a view (e.g. a mapped file)
+                if(this->word_count()){ std::memcpy(mutable_words(), other.data(), this->word_count() * sizeof(std::uint64_t)); }
+            }
+            bitset(const bitset& other) : bitset(static_cast<const bitset_view&>(other)) {}
+            bitset(bitset&& other) noexcept { swap(other); }
+            bitset& operator=(const bitset& other){ if(this != &other){ bitset(other).swap(*this); } return *this; }
+            bitset& operator=(bitset&& other) noexcept { bitset(std::move(other)).swap(*this); return *this; }
+            ~bitset(){ if(owned){ ::operator delete(owned, std::align_val_t{bitset_detail::ALIGNMENT}); } }
+
+            void swap(bitset& other) noexcept {
+                std::swap(this->owned, other.owned);
+                std::swap(this->info, other.info);
+                std::swap(this->words, other.words);
+                std::swap(this->bits, other.bits);
+            }
+
+            //size
+            void resize(size_t N){ //keeps the first min(size, N) bits, new bits are zero
+                bitset grown(N);
+                size_t keep = std::min((this->bits + 63) / 64, (N + 63) / 64); //the padding words stay zero
+                if(keep){ std::memcpy(grown.mutable_words(), this->words, keep * sizeof(std::uint64_t)); }
+                grown.trim();
+                swap(grown);
+            }
+
+            //modifying || O(1)
+            void set(size_t i) noexcept { mutable_words()[i / 64] |= std::uint64_t(1) << (i % 64); }
+            void set(size_t i, bool value) noexcept { //branch-free
+                std::uint64_t& word = mutable_words()[i / 64];
+                word = (word & ~(std::uint64_t(1) << (i % 64))) | (std::uint64_t(value) << (i % 64));
+            }
+            void reset(size_t i) noexcept { mutable_words()[i / 64] &= ~(std::uint64_t(1) << (i % 64)); }
+            void flip(size_t i) noexcept { mutable_words()[i / 64] ^= std::uint64_t(1) << (i % 64); }
+            std::uint64_t* data(void) noexcept { return mutable_words(); }
+            using bitset_view::data;
+
+            //bulk || O(n / 256) with AVX2
+            void set(void) noexcept { std::memset(mutable_words(), 0xFF, (this->bits + 63) / 64 * sizeof(std::uint64_t)); trim(); } //all bits
+            void reset(void) noexcept { std::memset(mutable_words(), 0, this->word_count() * sizeof(std::uint64_t)); } //no bits
+            void flip(void) noexcept { //every bit
+                for(size_t i = 0; i < (this->bits + 63) / 64; i++){ mutable_words()[i] = ~this->words[i]; }
+                trim();
+            }
+            bitset& operator&=(const bitset_view& other){ return combine<bitset_detail::operation::AND>(other); }
+            bitset& operator|=(const bitset_view& other){ return combine<bitset_detail::operation::OR>(other); }
+            bitset& operator^=(const bitset_view& other){ return combine<bitset_detail::operation::XOR>(other); }
+            bitset& and_not(const bitset_view& other){ return combine<bitset_detail::operation::AND_NOT>(other); } //removes other's bits (set difference)
+    };
+
+    //=> Free functions rather than friends of bitset, so that ADL finds them for two views too (e.g. two mapped files).
+    inline bitset operator&(const bitset_view& left, const bitset_view& right){ bitset result(left); result &= right; return result; }
+    inline bitset operator|(const bitset_view& left, const bitset_view& right){ bitset result(left); result |= right; return result; }
+    inline bitset operator^(const bitset_view& left, const bitset_view& right){ bitset result(left); result ^= right; return result; }
+}
+#endif
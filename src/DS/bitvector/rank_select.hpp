@@ -0,0 +1,235 @@
+#ifndef RANK_SELECT_HPP
+#define RANK_SELECT_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#if defined(__BMI2__)
+  #include <immintrin.h>
+#endif
+#include <DS/file/mapped_file.hpp> //=> for DSA::mapped_file
+
+namespace DSA{
+    using size_t = long unsigned int;
+
+    /* >=====> Rank/Select Bitvector (Poppy Layout) <=====< */
+    //=> A static bitvector with constant time rank (ones before a position) and select (position of
+    //=> the k-th one or zero), for about 3.2% space over the bits themselves:
+    //=>   - L1: one 64-bit entry per 2048-bit basic block: the ones before the block (32 bits, relative
+    //=>     to L0) and the ones in its first three 512-bit sub-blocks (3 x 10 bits),
+    //=>   - L0: the ones before every 2^32 bits (only matters past 4G bits),
+    //=>   - samples: the basic block holding every 8192nd one (and zero), so select only has to
+    //=>     binary search the few L1 entries between two samples.
+    //=> rank(i) reads one L1 entry (1/32 of the bits, mostly cached) and popcounts at most 8 words of
+    //=> a single cache line. A sorted set of dense IDs becomes 1 bit per possible ID instead of 32.
+    //=> Everything lives in one 64-byte aligned buffer, which is also the file format: save() writes
+    //=> it and the mapped_file constructor uses the file's pages in place, with no parsing or copying.
+    class rank_select_bitvector {
+        private:
+            static constexpr std::uint64_t MAGIC = 0x3156425352415344ull; //=> "DSARSBV1"
+            static constexpr size_t BLOCK = 2048, SUB_BLOCK = 512, SAMPLE = 8192; //=> in bits, bits, ones
+            static constexpr size_t ALIGNMENT = 64;
+
+            struct header { //=> 64 bytes, so the words that follow stay aligned
+                std::uint64_t magic, bits, ones, words, blocks, supers, samples1, samples0;
+            };
+
+            std::uint64_t* owned = nullptr; //=> the buffer when built in memory, null when mapped
+            mapped_file file;
+            const header* info = nullptr;
+            const std::uint64_t* words = nullptr; //=> the bits, padded to whole cache lines
+            const std::uint64_t* l1 = nullptr;
+            const std::uint64_t* l0 = nullptr;
+            const std::uint64_t* samples1 = nullptr; //=> one more entry than needed, a sentinel
+            const std::uint64_t* samples0 = nullptr;
+
+            static size_t padded(size_t count) noexcept { return (count + 7) / 8 * 8; } //=> whole cache lines of words
+            static size_t buffer_words(const header& h) noexcept {
+                return 8 + padded(h.words) + padded(h.blocks) + padded(h.supers) + padded(h.samples1) + padded(h.samples0);
+            }
+            void attach(const std::uint64_t* base){ //=> points every array into a buffer
+                info = reinterpret_cast<const header*>(base);
+                words = base + 8;
+                l1 = words + padded(info->words);
+                l0 = l1 + padded(info->blocks);
+                samples1 = l0 + padded(info->supers);
+                samples0 = samples1 + padded(info->samples1);
+            }
+            void release(void) noexcept {
+                if(owned != nullptr){ ::operator delete(owned, std::align_val_t{ALIGNMENT}); owned = nullptr; }
+            }
+
+            size_t before(size_t block) const noexcept { //=> ones before a basic block
+                return l0[block * BLOCK >> 32] + (l1[block] & 0xFFFFFFFFull);
+            }
+            template<bool One>
+            size_t count_before(size_t block) const noexcept { return One ? before(block) : block * BLOCK - before(block); }
+            template<bool One>
+            static size_t count_in(std::uint64_t word) noexcept { return std::popcount(One ? word : ~word); }
+
+            static size_t select_in_word(std::uint64_t word, size_t k) noexcept { //=> position of the k-th one of word
+#if defined(__BMI2__)
+                return std::countr_zero(_pdep_u64(std::uint64_t(1) << k, word));
+#else
+                size_t shift = 0;
+                for(size_t c = std::popcount(word & 0xFF); k >= c; c = std::popcount((word >> shift) & 0xFF)){ k -= c; shift += 8; } //=> find the byte
+                for(word >>= shift; k > 0; k--){ word &= word - 1; }
+                return shift + std::countr_zero(word);
+#endif
+            }
+
+            template<bool One>
+            size_t select(size_t k) const noexcept {
+                size_t total = One ? info->ones : info->bits - info->ones;
+                if(k >= total){ return info->bits; }
+                const std::uint64_t* samples = One ? samples1 : samples0;
+                size_t low = samples[k / SAMPLE], high = samples[k / SAMPLE + 1] + 1; //=> the block is in [low, high)
+                while(high - low > 1){ //=> last block with count_before <= k
+                    size_t mid = low + (high - low) / 2;
+                    if(count_before<One>(mid) <= k){ low = mid; } else { high = mid; }
+                }
+                size_t block = low;
+                k -= count_before<One>(block);
+                size_t word = block * (BLOCK / 64), entry = l1[block] >> 32;
+                for(size_t sub = 0; sub < 3; sub++, entry >>= 10){ //=> skip whole 512-bit sub-blocks
+                    size_t ones = entry & 0x3FF, count = One ? ones : SUB_BLOCK - ones;
+                    if(k < count){ break; }
+                    k -= count;
+                    word += SUB_BLOCK / 64;
+                }
+                for(size_t c = count_in<One>(words[word]); k >= c; c = count_in<One>(words[++word])){ k -= c; }
+                return word * 64 + select_in_word(One ? words[word] : ~words[word], k);
+            }
+
+        public:
+            /*assigning*/
+            rank_select_bitvector() = default;
+            rank_select_bitvector(const std::uint64_t* bits, size_t N){ //=> copies N bits (bit i = word i / 64, bit i % 64) and indexes them, O(n / 64)
+                header h{MAGIC, N, 0, (N + 63) / 64, (N + BLOCK - 1) / BLOCK, (N >> 32) + 1, 0, 0};
+                size_t ones = 0;
+                for(size_t i = 0; i < h.words; i++){
+                    std::uint64_t word = bits[i];
+                    if(i == h.words - 1 && N % 64){ word &= (std::uint64_t(1) << (N % 64)) - 1; } //=> no stray bits past N
+                    ones += std::popcount(word);
+                }
+                h.ones = ones;
+                h.samples1 = ones / SAMPLE + 2;
+                h.samples0 = (N - ones) / SAMPLE + 2;
+
+                size_t total = buffer_words(h);
+                owned = static_cast<std::uint64_t*>(::operator new(total * sizeof(std::uint64_t), std::align_val_t{ALIGNMENT}));
+                std::memset(owned, 0, total * sizeof(std::uint64_t));
+                std::memcpy(owned, &h, sizeof(header));
+                attach(owned);
+                std::uint64_t* w = owned + 8;
+                if(h.words){ std::memcpy(w, bits, h.words * sizeof(std::uint64_t)); }
+                if(N % 64){ w[h.words - 1] &= (std::uint64_t(1) << (N % 64)) - 1; }
+
+                std::uint64_t* level1 = const_cast<std::uint64_t*>(l1);
+                std::uint64_t* level0 = const_cast<std::uint64_t*>(l0);
+                std::uint64_t* sample1 = const_cast<std::uint64_t*>(samples1);
+                std::uint64_t* sample0 = const_cast<std::uint64_t*>(samples0);
+                size_t rank = 0, next1 = 0, next0 = 0;
+                for(size_t block = 0; block < h.blocks; block++){
+                    if((block * BLOCK) % (size_t(1) << 32) == 0){ level0[block * BLOCK >> 32] = rank; }
+                    std::uint64_t entry = rank - level0[block * BLOCK >> 32];
+                    size_t in_block = 0;
+                    for(size_t sub = 0; sub < 4; sub++){
+                        size_t count = 0;
+                        for(size_t i = 0; i < SUB_BLOCK / 64; i++){
+                            size_t index = block * (BLOCK / 64) + sub * (SUB_BLOCK / 64) + i;
+                            if(index < h.words){ count += std::popcount(w[index]); }
+                        }
+                        if(sub < 3){ entry |= std::uint64_t(count) << (32 + 10 * sub); }
+                        in_block += count;
+                    }
+                    level1[block] = entry;
+                    size_t zeros_before = block * BLOCK - rank, bits_here = (block + 1) * BLOCK <= N ? BLOCK : N - block * BLOCK;
+                    for(; next1 * SAMPLE < rank + in_block; next1++){ sample1[next1] = block; }
+                    for(; next0 * SAMPLE < zeros_before + bits_here - in_block; next0++){ sample0[next0] = block; }
+                    rank += in_block;
+                }
+                for(; next1 < h.samples1; next1++){ sample1[next1] = h.blocks ? h.blocks - 1 : 0; } //=> sentinels
+                for(; next0 < h.samples0; next0++){ sample0[next0] = h.blocks ? h.blocks - 1 : 0; }
+            }
+
+            //=> a set of distinct sorted IDs as a bitvector over [0, universe), universe = last ID + 1 by default
+            template<class T>
+            static rank_select_bitvector from_sorted(const T* ids, size_t N, size_t universe = 0){
+                if(universe == 0 && N != 0){ universe = size_t(ids[N - 1]) + 1; }
+                std::uint64_t* bits = new std::uint64_t[(universe + 63) / 64 + 1]();
+                for(size_t i = 0; i < N; i++){
+                    if(size_t(ids[i]) >= universe){ delete[] bits; throw std::out_of_range("Error: ID is out of the universe!"); }
+                    bits[size_t(ids[i]) / 64] |= std::uint64_t(1) << (size_t(ids[i]) % 64);
+                }
+                rank_select_bitvector result(bits, universe);
+                delete[] bits;
+                return result;
+            }
+
+            explicit rank_select_bitvector(mapped_file mapped) : file(std::move(mapped)) { //=> uses a saved bitvector in place, O(1)
+                if(file.size() < sizeof(header) || file.as<header>()->magic != MAGIC){ throw std::runtime_error("Error: Not a rank/select bitvector file!"); }
+                if(file.size() < buffer_words(*file.as<header>()) * sizeof(std::uint64_t)){ throw std::runtime_error("Error: Bitvector file is truncated!"); }
+                attach(file.as<std::uint64_t>());
+            }
+            explicit rank_select_bitvector(const std::string& path) : rank_select_bitvector(mapped_file(path)) {}
+
+            rank_select_bitvector(const rank_select_bitvector&) = delete;
+            rank_select_bitvector& operator=(const rank_select_bitvector&) = delete;
+            rank_select_bitvector(rank_select_bitvector&& other) noexcept { swap(other); }
+            rank_select_bitvector& operator=(rank_select_bitvector&& other) noexcept { rank_select_bitvector(std::move(other)).swap(*this); return *this; }
+            ~rank_select_bitvector(){ release(); }
+
+            void swap(rank_select_bitvector& other) noexcept {
+                std::swap(owned, other.owned); file.swap(other.file); std::swap(info, other.info); std::swap(words, other.words);
+                std::swap(l1, other.l1); std::swap(l0, other.l0); std::swap(samples1, other.samples1); std::swap(samples0, other.samples0);
+            }
+
+            void save(const std::string& path) const { //=> the in-memory buffer is the file format
+                if(info == nullptr){ throw std::logic_error("Error: Bitvector is empty!"); }
+                mapped_file::write(path, info, buffer_words(*info) * sizeof(std::uint64_t));
+            }
+
+            //accessing || O(1)
+            bool operator[](size_t i) const noexcept { return words[i / 64] >> (i % 64) & 1; }
+            bool test(size_t i) const { // access by a function with an exception
+                if(info == nullptr || i >= info->bits){ throw std::out_of_range("Error: Index is out of range!"); }
+                return (*this)[i];
+            }
+
+            //ranking || O(1): one L1 entry and at most 8 words of one cache line
+            size_t rank1(size_t i) const noexcept { //=> ones in [0, i)
+                if(info == nullptr){ return 0; }
+                if(i >= info->bits){ return info->ones; }
+                size_t block = i / BLOCK, sub = i % BLOCK / SUB_BLOCK;
+                size_t rank = before(block);
+                std::uint64_t entry = l1[block] >> 32;
+                for(size_t s = 0; s < sub; s++, entry >>= 10){ rank += entry & 0x3FF; }
+                size_t word = block * (BLOCK / 64) + sub * (SUB_BLOCK / 64);
+                for(; word < i / 64; word++){ rank += std::popcount(words[word]); }
+                return rank + std::popcount(words[word] & ((std::uint64_t(1) << (i % 64)) - 1));
+            }
+            size_t rank0(size_t i) const noexcept { return (info != nullptr && i >= info->bits ? info->bits : i) - rank1(i); } //=> zeros in [0, i)
+
+            //selecting || O(1) expected: a short binary search between two samples, then one sub-block
+            size_t select1(size_t k) const noexcept { return info == nullptr ? 0 : select<true>(k); } //=> position of the k-th one (from 0), size() if there is none
+            size_t select0(size_t k) const noexcept { return info == nullptr ? 0 : select<false>(k); } //=> position of the k-th zero (from 0), size() if there is none
+
+            //searching, as a set of IDs
+            bool contains(size_t id) const noexcept { return info != nullptr && id < info->bits && (*this)[id]; }
+            size_t search(size_t id) const noexcept { return contains(id) ? rank1(id) : size_t(-1); } //=> index of id in the sorted IDs, or -1 like binary::binary_search
+
+            //size and capacity
+            size_t size(void) const noexcept { return info == nullptr ? 0 : info->bits; } //=> bits
+            size_t count(void) const noexcept { return info == nullptr ? 0 : info->ones; } //=> ones
+            bool empty(void) const noexcept { return size() == 0; }
+            size_t size_in_bytes(void) const noexcept { return info == nullptr ? 0 : buffer_words(*info) * sizeof(std::uint64_t); }
+            const std::uint64_t* data(void) const noexcept { return words; }
+    };
+}
+#endif
@@ -0,0 +1,101 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <fstream>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#if defined(__unix__) || defined(__APPLE__)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+  #define DSA_HAS_MMAP 1
+#endif
+
+namespace DSA{
+    using size_t = long unsigned int;
+
+    /* >=====> Memory-Mapped File <=====< */
+    //=> A read-only view of a whole file. With mmap the pages are only read from disk when first
+    //=> touched and are shared with every other process mapping the same file, so a large index
+    //=> "loads" in O(1). Without mmap (non-POSIX systems) the file is read into a 64-byte aligned buffer.
+    //=> The mapping is page aligned, so structures laid out with 64-byte alignment stay aligned.
+    class mapped_file {
+        private:
+            const void* address = nullptr;
+            size_t length = 0;
+
+        public:
+            /*assigning*/
+            mapped_file() = default;
+            explicit mapped_file(const std::string& path){
+#if defined(DSA_HAS_MMAP)
+                int descriptor = ::open(path.c_str(), O_RDONLY);
+                if(descriptor < 0){ throw std::runtime_error("Error: Cannot open " + path + "!"); }
+                struct stat status;
+                if(::fstat(descriptor, &status) != 0){ ::close(descriptor); throw std::runtime_error("Error: Cannot stat " + path + "!"); }
+                length = size_t(status.st_size);
+                if(length != 0){
+                    void* mapped = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, descriptor, 0);
+                    if(mapped == MAP_FAILED){ ::close(descriptor); throw std::runtime_error("Error: Cannot map " + path + "!"); }
+                    address = mapped;
+                }
+                ::close(descriptor); //=> the mapping keeps the file alive
+#else
+                std::ifstream file(path, std::ios::binary | std::ios::ate);
+                if(!file){ throw std::runtime_error("Error: Cannot open " + path + "!"); }
+                length = size_t(file.tellg());
+                void* buffer = ::operator new(length ? length : 1, std::align_val_t{64});
+                file.seekg(0);
+                file.read(static_cast<char*>(buffer), std::streamsize(length));
+                address = buffer;
+#endif
+            }
+            mapped_file(const mapped_file&) = delete;
+            mapped_file& operator=(const mapped_file&) = delete;
+            mapped_file(mapped_file&& other) noexcept { swap(other); }
+            mapped_file& operator=(mapped_file&& other) noexcept { mapped_file(std::move(other)).swap(*this); return *this; }
+            ~mapped_file(){
+#if defined(DSA_HAS_MMAP)
+                if(address != nullptr){ ::munmap(const_cast<void*>(address), length); }
+#else
+                if(address != nullptr){ ::operator delete(const_cast<void*>(address), std::align_val_t{64}); }
+#endif
+            }
+
+            void swap(mapped_file& other) noexcept {
+                std::swap(address, other.address); std::swap(length, other.length);
+            }
+
+            //accessing
+            const std::byte* data(void) const noexcept { return static_cast<const std::byte*>(address); }
+            template<class T>
+            const T* as(size_t offset = 0) const noexcept { return reinterpret_cast<const T*>(data() + offset); } //=> a T array at a byte offset
+            size_t size(void) const noexcept { return length; }
+            bool empty(void) const noexcept { return length == 0; }
+
+            //operations
+            void advise_random(void) const noexcept { //=> no read-ahead: suits point lookups into a large index
+#if defined(DSA_HAS_MMAP)
+                if(address != nullptr){ ::madvise(const_cast<void*>(address), length, MADV_RANDOM); }
+#endif
+            }
+            void advise_sequential(void) const noexcept { //=> aggressive read-ahead: suits full scans
+#if defined(DSA_HAS_MMAP)
+                if(address != nullptr){ ::madvise(const_cast<void*>(address), length, MADV_SEQUENTIAL); }
+#endif
+            }
+
+            //=> writes size bytes from data to path (the counterpart used by the save() functions)
+            static void write(const std::string& path, const void* data, size_t size){
+                std::ofstream file(path, std::ios::binary | std::ios::trunc);
+                if(!file){ throw std::runtime_error("Error: Cannot create " + path + "!"); }
+                file.write(static_cast<const char*>(data), std::streamsize(size));
+                if(!file){ throw std::runtime_error("Error: Cannot write " + path + "!"); }
+            }
+    };
+}
+#endif
@@ -0,0 +1,63 @@
+/* >=====> Filtered Search Benchmark <=====< */
+//=> Sorted random keys from 1K up to 2^max elements (argv[1], default 24), queried with 90% absent
+//=> keys: average time per lookup of a plain binary::binary_search against the same search behind
+//=> a blocked Bloom filter and a cuckoo filter (one by one and batched), with the observed rate of
+//=> false positives next to the one each filter expects.
+//=> Build with: cmake -S . -B build -DCMAKE_BUILD_TYPE=Release -DBUILD_BENCHMARKS=ON
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <fmt/core.h>
+#include <binary.hpp>
+#include <filtered_search.hpp>
+
+using element = std::uint64_t;
+
+template<class Work>
+double measure(size_t count, Work work){
+  auto start = std::chrono::steady_clock::now();
+  work();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(stop - start).count() / count;
+}
+
+int main(int argc, char** argv){
+  size_t max_log = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 24;
+  constexpr size_t Q = 1 << 20; //=> lookups per size
+
+  std::mt19937_64 random(42);
+  auto queries = std::make_unique<element[]>(Q);
+  auto out = std::make_unique<size_t[]>(Q);
+
+  fmt::print("{:>10} | {:>10} | {:>10} | {:>13} | {:>10} | {:>13} | {:>22} | {:>22}\n",
+             "elements", "binary", "bloom", "bloom (batch)", "cuckoo", "cuckoo (batch)", "bloom fpr (expected)", "cuckoo fpr (expected)");
+  for(size_t log = 10; log <= max_log; log += 2){
+    size_t N = size_t(1) << log;
+    auto arr = std::make_unique<element[]>(N);
+    for(size_t i = 0; i < N; i++){ arr[i] = random() | 1; } //=> odd keys only
+    std::sort(arr.get(), arr.get() + N);
+    for(size_t q = 0; q < Q; q++){ queries[q] = (q % 10 == 0) ? arr[random() % N] : random() & ~element(1); }
+
+    element* data = arr.get();
+    auto search = [data, N](element key){ return binary::binary_search(data, key, N); };
+    size_t checksum = 0;
+    double plain = measure(Q, [&]{ for(size_t q = 0; q < Q; q++){ checksum += search(queries[q]); } });
+
+    DSA::filtered_search bloom(DSA::blocked_bloom_filter<element>(data, N), search);
+    double bloomed = measure(Q, [&]{ for(size_t q = 0; q < Q; q++){ checksum += bloom.search(queries[q]); } });
+    double bloom_batch = measure(Q, [&]{ bloom.search(queries.get(), Q, out.get()); });
+
+    DSA::filtered_search cuckoo(DSA::cuckoo_filter<element>(data, N), search);
+    double cuckooed = measure(Q, [&]{ for(size_t q = 0; q < Q; q++){ checksum += cuckoo.search(queries[q]); } });
+    double cuckoo_batch = measure(Q, [&]{ cuckoo.search(queries.get(), Q, out.get()); });
+
+    fmt::print("{:>10} | {:>7.1f} ns | {:>7.1f} ns | {:>10.1f} ns | {:>7.1f} ns | {:>10.1f} ns | {:>9.4f}% ({:>7.4f}%) | {:>9.4f}% ({:>7.4f}%)   (checksum {})\n",
+               N, plain, bloomed, bloom_batch, cuckooed, cuckoo_batch,
+               100 * bloom.stats().false_positive_rate(), 100 * bloom.expected_fpr(),
+               100 * cuckoo.stats().false_positive_rate(), 100 * cuckoo.expected_fpr(), checksum + out[Q - 1]);
+  }
+  return 0;
+}
@@ -0,0 +1,120 @@
+#ifndef BLOOM_FILTER_HPP
+#define BLOOM_FILTER_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <utility>
+#if defined(__AVX2__)
+  #include <immintrin.h>
+#endif
+#include <DS/hash/flat_hash_map.hpp> //=> for hash_detail::mix
+#include <Algorithms/Divide_and_Conquer/Search/Binary/binary.hpp> //=> for binary::prefetch
+
+namespace DSA{
+    using size_t = long unsigned int;
+
+    /* >=====> Blocked Bloom Filter <=====< */
+    //=> A split-block Bloom filter: every key maps to one 256-bit block (half a cache line) and sets
+    //=> exactly one bit in each of the block's eight 32-bit words, each picked by multiplying the
+    //=> hash with a different odd salt. A probe therefore touches a single cache line, and with AVX2
+    //=> the eight bit positions are built and tested with one multiply, shift and vptest.
+    //=> No false negatives; about 1.3% false positives at 10 bits per key, 0.13% at 16.
+    template<class K, class Hash = std::hash<K>>
+    class blocked_bloom_filter {
+        private:
+            struct alignas(32) block { std::uint32_t words[8]; };
+            static constexpr size_t ALIGNMENT = 64;
+            alignas(32) static constexpr std::uint32_t SALTS[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+            block* blocks = nullptr;
+            size_t count = 0; //=> number of blocks
+            size_t inserted = 0;
+            [[no_unique_address]] Hash hasher;
+
+            size_t hash_of(const K& key) const { return hash_detail::mix(hasher(key)); }
+            //=> the upper 32 hash bits pick the block (multiply-shift, no modulo), the lower 32 the bits
+            size_t block_of(size_t hash) const noexcept { return ((hash >> 32) * count) >> 32; }
+
+            static bool test(const block& b, std::uint32_t h) noexcept {
+#if defined(__AVX2__)
+                __m256i shifts = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32(int(h)), _mm256_load_si256(reinterpret_cast<const __m256i*>(SALTS))), 27);
+                __m256i mask = _mm256_sllv_epi32(_mm256_set1_epi32(1), shifts);
+                return _mm256_testc_si256(_mm256_load_si256(reinterpret_cast<const __m256i*>(b.words)), mask); //=> every mask bit set
+#else
+                std::uint32_t missing = 0; //=> branch-free, so the compiler can vectorize it
+                for(size_t i = 0; i < 8; i++){ missing |= ~b.words[i] & (std::uint32_t(1) << ((h * SALTS[i]) >> 27)); }
+                return missing == 0;
+#endif
+            }
+
+        public:
+            using key_type = K;
+
+            /*assigning*/
+            explicit blocked_bloom_filter(size_t expected, double bits_per_key = 10.0){ //=> sized for expected keys
+                count = size_t(std::ceil(double(expected ? expected : 1) * bits_per_key / 256.0));
+                blocks = static_cast<block*>(::operator new(count * sizeof(block), std::align_val_t{ALIGNMENT}));
+                std::memset(blocks, 0, count * sizeof(block));
+            }
+            blocked_bloom_filter(const K* keys, size_t N, double bits_per_key = 10.0) : blocked_bloom_filter(N, bits_per_key) {
+                for(size_t i = 0; i < N; i++){ insert(keys[i]); }
+            }
+            blocked_bloom_filter(const blocked_bloom_filter&) = delete;
+            blocked_bloom_filter& operator=(const blocked_bloom_filter&) = delete;
+            blocked_bloom_filter(blocked_bloom_filter&& other) noexcept
+                : blocks(std::exchange(other.blocks, nullptr)), count(std::exchange(other.count, 0)), inserted(std::exchange(other.inserted, 0)), hasher(std::move(other.hasher)) {}
+            blocked_bloom_filter& operator=(blocked_bloom_filter&& other) noexcept {
+                std::swap(blocks, other.blocks); std::swap(count, other.count); std::swap(inserted, other.inserted); std::swap(hasher, other.hasher);
+                return *this;
+            }
+            ~blocked_bloom_filter(){ if(blocks != nullptr){ ::operator delete(blocks, std::align_val_t{ALIGNMENT}); } }
+
+            //operations
+            bool insert(const K& key){ //=> always succeeds, true for the interface shared with cuckoo_filter
+                size_t hash = hash_of(key);
+                block& b = blocks[block_of(hash)];
+                std::uint32_t h = std::uint32_t(hash);
+                for(size_t i = 0; i < 8; i++){ b.words[i] |= std::uint32_t(1) << ((h * SALTS[i]) >> 27); } //=> vectorized by the compiler
+                inserted++;
+                return true;
+            }
+            bool contains(const K& key) const { //=> false means absent, true means probably present
+                size_t hash = hash_of(key);
+                return test(blocks[block_of(hash)], std::uint32_t(hash));
+            }
+
+            //=> Batched probe: hashes and prefetches a group of keys before testing any of them, so the
+            //=> cache misses of the group overlap instead of being paid one after another.
+            void contains(const K* keys, size_t N, bool* out) const {
+                constexpr size_t GROUP = 16;
+                size_t hashes[GROUP];
+                for(size_t first = 0; first < N; first += GROUP){
+                    size_t width = N - first < GROUP ? N - first : GROUP;
+                    for(size_t i = 0; i < width; i++){
+                        hashes[i] = hash_of(keys[first + i]);
+                        binary::prefetch(blocks + block_of(hashes[i]));
+                    }
+                    for(size_t i = 0; i < width; i++){ out[first + i] = test(blocks[block_of(hashes[i])], std::uint32_t(hashes[i])); }
+                }
+            }
+
+            //size and statistics
+            size_t size(void) const noexcept { return inserted; } //=> keys inserted (with duplicates)
+            size_t size_in_bytes(void) const noexcept { return count * sizeof(block); }
+            double expected_fpr(void) const noexcept {
+                //=> A block holding k keys answers a wrong yes with chance (1 - (31/32)^k)^8; block loads
+                //=> are Poisson(n / blocks), and the overloaded blocks are what dominate the rate.
+                double lambda = double(inserted) / double(count), p = std::exp(-lambda), rate = 0.0;
+                for(size_t k = 0; k <= size_t(lambda + 12.0 * std::sqrt(lambda) + 12.0); k++){
+                    if(k > 0){ p *= lambda / double(k); }
+                    rate += p * std::pow(1.0 - std::pow(31.0 / 32.0, double(k)), 8.0);
+                }
+                return rate;
+            }
+    };
+}
+#endif
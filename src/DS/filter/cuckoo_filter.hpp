@@ -0,0 +1,150 @@
+#ifndef CUCKOO_FILTER_HPP
+#define CUCKOO_FILTER_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#if defined(__SSE2__) || defined(_M_X64)
+  #include <emmintrin.h>
+#endif
+#include <DS/hash/flat_hash_map.hpp> //=> for hash_detail::mix
+#include <Algorithms/Divide_and_Conquer/Search/Binary/binary.hpp> //=> for binary::prefetch
+
+namespace DSA{
+    using size_t = long unsigned int;
+
+    /* >=====> Cuckoo Filter <=====< */
+    //=> Stores a 16-bit fingerprint of every key in one of two buckets of 4 slots. The second bucket
+    //=> is the first XOR a hash of the fingerprint, so a fingerprint can move between its two buckets
+    //=> without the key, which is what makes erase() possible (unlike a Bloom filter).
+    //=> A bucket is one 64-bit word; a probe loads both buckets and compares all 8 slots against the
+    //=> fingerprint with a single SSE2 16-bit compare (or a SWAR zero-lane test without SSE2).
+    //=> About 2 * 4 / 2^16 = 0.012% false positives at up to 95% load.
+    template<class K, class Hash = std::hash<K>>
+    class cuckoo_filter {
+        private:
+            static constexpr size_t SLOTS = 4; //=> fingerprints per bucket
+            static constexpr size_t MAX_KICKS = 500; //=> relocations before an insert gives up
+            static constexpr std::uint64_t LANES = 0x0001000100010001ull;
+
+            std::unique_ptr<std::uint64_t[]> buckets; //=> 4 x 16-bit fingerprints, 0 = empty slot
+            size_t mask = 0; //=> number of buckets - 1 (a power of two)
+            size_t inserted = 0;
+            std::uint16_t victim = 0; //=> a fingerprint evicted by a failed insert, kept so nothing is lost
+            size_t victim_bucket = 0;
+            [[no_unique_address]] Hash hasher;
+
+            static std::uint16_t fingerprint(size_t hash) noexcept { std::uint16_t f = std::uint16_t(hash >> 48); return f ? f : 1; }
+            size_t alternate(size_t bucket, std::uint16_t f) const noexcept { return (bucket ^ hash_detail::mix(f)) & mask; }
+
+            static std::uint16_t lane(std::uint64_t bucket, size_t i) noexcept { return std::uint16_t(bucket >> (16 * i)); }
+            static bool has(std::uint64_t bucket, std::uint16_t f) noexcept { //=> SWAR: a lane of bucket ^ f is zero
+                std::uint64_t x = bucket ^ (LANES * f);
+                return ((x - LANES) & ~x & (LANES << 15)) != 0;
+            }
+            bool has(size_t first, size_t second, std::uint16_t f) const noexcept { //=> both buckets at once
+#if defined(__SSE2__) || defined(_M_X64)
+                __m128i pair = _mm_set_epi64x(std::int64_t(buckets[second]), std::int64_t(buckets[first]));
+                return _mm_movemask_epi8(_mm_cmpeq_epi16(pair, _mm_set1_epi16(std::int16_t(f)))) != 0;
+#else
+                return has(buckets[first], f) || has(buckets[second], f);
+#endif
+            }
+            bool put(size_t bucket, std::uint16_t f) noexcept { //=> into a free slot of bucket, if any
+                for(size_t i = 0; i < SLOTS; i++){
+                    if(lane(buckets[bucket], i) == 0){ buckets[bucket] |= std::uint64_t(f) << (16 * i); return true; }
+                }
+                return false;
+            }
+            bool remove(size_t bucket, std::uint16_t f) noexcept { //=> one copy of f from bucket, if any
+                for(size_t i = 0; i < SLOTS; i++){
+                    if(lane(buckets[bucket], i) == f){ buckets[bucket] &= ~(std::uint64_t(0xFFFF) << (16 * i)); return true; }
+                }
+                return false;
+            }
+
+        public:
+            using key_type = K;
+
+            /*assigning*/
+            explicit cuckoo_filter(size_t expected){ //=> sized for expected keys at <= 95% load
+                size_t needed = size_t(double(expected ? expected : 1) / (SLOTS * 0.95)) + 1;
+                size_t count = std::bit_ceil(needed);
+                buckets = std::make_unique<std::uint64_t[]>(count); //=> zeroed: all slots empty
+                mask = count - 1;
+            }
+            cuckoo_filter(const K* keys, size_t N) : cuckoo_filter(N) {
+                for(size_t i = 0; i < N; i++){ insert(keys[i]); }
+            }
+
+            //operations
+            //=> false only when the filter is full: a previous insert already had to park a victim.
+            //=> Inserting the same key k times stores k fingerprints (at most 2 * 4 per key).
+            bool insert(const K& key){
+                if(victim != 0){ return false; }
+                size_t hash = hash_detail::mix(hasher(key));
+                std::uint16_t f = fingerprint(hash);
+                size_t bucket = hash & mask, other = alternate(bucket, f);
+                inserted++;
+                if(put(bucket, f) || put(other, f)){ return true; }
+
+                bucket = (hash >> 20 & 1) ? bucket : other; //=> kick from a pseudo-random one of the two
+                for(size_t kick = 0; kick < MAX_KICKS; kick++){
+                    size_t i = (hash >> (kick % 48)) % SLOTS;
+                    std::uint16_t evicted = lane(buckets[bucket], i);
+                    buckets[bucket] = (buckets[bucket] & ~(std::uint64_t(0xFFFF) << (16 * i))) | (std::uint64_t(f) << (16 * i));
+                    f = evicted;
+                    bucket = alternate(bucket, f);
+                    if(put(bucket, f)){ return true; }
+                }
+                victim = f; victim_bucket = bucket; //=> still findable, but the filter is now full
+                return true;
+            }
+            bool contains(const K& key) const { //=> false means absent, true means probably present
+                size_t hash = hash_detail::mix(hasher(key));
+                std::uint16_t f = fingerprint(hash);
+                size_t bucket = hash & mask, other = alternate(bucket, f);
+                return has(bucket, other, f) || (victim == f && (victim_bucket == bucket || victim_bucket == other));
+            }
+            bool erase(const K& key){ //=> only erase keys that were inserted, or another key's fingerprint may go
+                size_t hash = hash_detail::mix(hasher(key));
+                std::uint16_t f = fingerprint(hash);
+                size_t bucket = hash & mask, other = alternate(bucket, f);
+                if(victim == f && (victim_bucket == bucket || victim_bucket == other)){ victim = 0; }
+                else if(!remove(bucket, f) && !remove(other, f)){ return false; }
+                inserted--;
+                if(victim != 0 && put(victim_bucket, victim)){ victim = 0; } //=> room again for the parked victim
+                return true;
+            }
+
+            //=> Batched probe: hashes and prefetches both buckets of a group of keys before testing.
+            void contains(const K* keys, size_t N, bool* out) const {
+                constexpr size_t GROUP = 16;
+                size_t hashes[GROUP], others[GROUP];
+                for(size_t first = 0; first < N; first += GROUP){
+                    size_t width = N - first < GROUP ? N - first : GROUP;
+                    for(size_t i = 0; i < width; i++){
+                        hashes[i] = hash_detail::mix(hasher(keys[first + i]));
+                        others[i] = alternate(hashes[i] & mask, fingerprint(hashes[i]));
+                        binary::prefetch(buckets.get() + (hashes[i] & mask));
+                        binary::prefetch(buckets.get() + others[i]);
+                    }
+                    for(size_t i = 0; i < width; i++){
+                        std::uint16_t f = fingerprint(hashes[i]);
+                        size_t bucket = hashes[i] & mask;
+                        out[first + i] = has(bucket, others[i], f) || (victim == f && (victim_bucket == bucket || victim_bucket == others[i]));
+                    }
+                }
+            }
+
+            //size and statistics
+            size_t size(void) const noexcept { return inserted; }
+            size_t size_in_bytes(void) const noexcept { return (mask + 1) * sizeof(std::uint64_t); }
+            double load_factor(void) const noexcept { return double(inserted) / double((mask + 1) * SLOTS); }
+            double expected_fpr(void) const noexcept { return 2.0 * SLOTS * load_factor() / 65535.0; } //=> 8 slots probed, each a 1 / (2^16 - 1) match
+    };
+}
+#endif
@@ -0,0 +1,90 @@
+#ifndef FILTERED_SEARCH_HPP
+#define FILTERED_SEARCH_HPP
+
+#include <cstddef>
+#include <utility>
+#include "bloom_filter.hpp"
+#include "cuckoo_filter.hpp"
+
+namespace DSA{
+    using size_t = long unsigned int;
+
+    /* >=====> Filtered Search <=====< */
+    //=> Puts a membership filter in front of a search so that most absent keys are answered by one
+    //=> filter probe (a cache line or two) instead of a full search. The search is either an index
+    //=> with a search(key) member (static_search_index, static_bplus_tree, pgm_index, searcher) or a
+    //=> callable, e.g. [&](int key){ return binary::binary_search(arr, key, N); }. Both return the
+    //=> position of key or -1, and so does filtered_search.
+    struct filter_stats {
+        size_t queries = 0;
+        size_t rejected = 0; //=> answered absent by the filter alone
+        size_t hits = 0; //=> passed the filter and found by the search
+        size_t false_positives = 0; //=> passed the filter but missed by the search
+
+        double false_positive_rate(void) const noexcept { //=> observed, over the absent keys queried
+            size_t negatives = rejected + false_positives;
+            return negatives ? double(false_positives) / double(negatives) : 0.0;
+        }
+        double skip_rate(void) const noexcept { return queries ? double(rejected) / double(queries) : 0.0; } //=> searches avoided
+    };
+
+    template<class Filter, class Search>
+    class filtered_search {
+        public:
+            using key_type = typename Filter::key_type;
+
+        private:
+            Filter filter_;
+            Search search_;
+            mutable filter_stats stats_; //=> plain counters: share one filtered_search between threads only without stats
+
+            size_t probe(const key_type& key) const {
+                size_t index;
+                if constexpr (requires { search_.search(key); }){ index = search_.search(key); }
+                else { index = search_(key); }
+                (index == size_t(-1) ? stats_.false_positives : stats_.hits)++;
+                return index;
+            }
+
+        public:
+            /*assigning*/
+            filtered_search(Filter filter, Search search) : filter_(std::move(filter)), search_(std::move(search)) {}
+            filtered_search(const key_type* keys, size_t N, Search search) : filter_(keys, N), search_(std::move(search)) {} //=> filters the N searchable keys
+
+            //searching
+            size_t search(const key_type& key) const { //=> index of key, or -1
+                stats_.queries++;
+                if(!filter_.contains(key)){ stats_.rejected++; return size_t(-1); }
+                return probe(key);
+            }
+            bool contains(const key_type& key) const { return search(key) != size_t(-1); }
+
+            //=> Batched version: the filter probes all keys first (prefetched), then only the keys that
+            //=> passed are searched, GROUP keys at a time: the filter's answers go to a local passed[GROUP].
+            void search(const key_type* keys, size_t N, size_t* out) const {
+                constexpr size_t GROUP = 64;
+                bool passed[GROUP];
+                for(size_t first = 0; first < N; first += GROUP){
+                    size_t width = N - first < GROUP ? N - first : GROUP;
+                    filter_.contains(keys + first, width, passed);
+                    for(size_t i = 0; i < width; i++){
+                        if(passed[i]){ out[first + i] = probe(keys[first + i]); }
+                        else { out[first + i] = size_t(-1); stats_.rejected++; }
+                    }
+                }
+                stats_.queries += N;
+            }
+
+            //statistics
+            const filter_stats& stats(void) const noexcept { return stats_; }
+            void reset_stats(void) noexcept { stats_ = filter_stats{}; }
+            double expected_fpr(void) const noexcept { return filter_.expected_fpr(); }
+            const Filter& filter(void) const noexcept { return filter_; }
+            Filter& filter(void) noexcept { return filter_; } //=> e.g. to erase keys from a cuckoo_filter
+            const Search& index(void) const noexcept { return search_; }
+    };
+
+    template<class K, class Search> //=> filtered_search(keys, N, search) defaults to a Bloom filter
+    filtered_search(const K*, size_t, Search) -> filtered_search<blocked_bloom_filter<K>, Search>;
+}
+#endif
@@ -0,0 +1,68 @@
+/* >=====> Concurrent Hash Map Benchmark <=====< */
+//=> 2^20 keys preloaded, then 1 up to max threads (argv[1], default 64) run a fixed number of
+//=> random operations at 95/5 and 50/50 read/write mixes: throughput of DSA::concurrent_hash_map
+//=> next to a std::unordered_map behind one std::shared_mutex.
+//=> Build with: cmake -S . -B build -DCMAKE_BUILD_TYPE=Release -DBUILD_BENCHMARKS=ON
+#include <chrono>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <fmt/core.h>
+#include <concurrent_hash_map.hpp>
+
+using element = std::uint64_t;
+constexpr size_t KEYS = 1 << 20;
+constexpr size_t OPERATIONS = 1 << 23; //=> split between the threads
+
+struct locked_map { //=> the baseline: one reader/writer lock around the standard map
+  std::unordered_map<element, element> map;
+  mutable std::shared_mutex lock;
+  bool contains(element key) const { std::shared_lock guard(lock); return map.count(key); }
+  void insert_or_assign(element key, element value){ std::unique_lock guard(lock); map.insert_or_assign(key, value); }
+};
+
+template<class Map>
+double run(Map& map, size_t threads, unsigned read_percent, std::atomic<size_t>& checksum){ //=> million operations per second
+  std::vector<std::thread> workers;
+  auto start = std::chrono::steady_clock::now();
+  for(size_t t = 0; t < threads; t++){
+    workers.emplace_back([&map, &checksum, t, threads, read_percent]{
+      std::mt19937_64 random(t);
+      size_t hits = 0;
+      for(size_t op = 0; op < OPERATIONS / threads; op++){
+        element key = random() % (KEYS * 2); //=> half the reads miss
+        if(random() % 100 < read_percent){ hits += map.contains(key); }
+        else { map.insert_or_assign(key, op); }
+      }
+      checksum += hits;
+    });
+  }
+  for(std::thread& worker : workers){ worker.join(); }
+  auto stop = std::chrono::steady_clock::now();
+  return OPERATIONS / std::chrono::duration<double, std::micro>(stop - start).count();
+}
+
+int main(int argc, char** argv){
+  size_t max_threads = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 64;
+
+  fmt::print("{:>8} | {:>6} | {:>24} | {:>24}\n", "threads", "mix", "concurrent_hash_map", "unordered_map + lock");
+  for(unsigned read_percent : {95u, 50u}){
+    for(size_t threads = 1; threads <= max_threads; threads *= 2){
+      DSA::concurrent_hash_map<element, element> sharded(KEYS * 2);
+      locked_map locked;
+      locked.map.reserve(KEYS * 2);
+      for(element key = 0; key < KEYS; key++){ sharded.insert_or_assign(key * 2, key); locked.map[key * 2] = key; }
+
+      std::atomic<size_t> checksum{0};
+      double fast = run(sharded, threads, read_percent, checksum), slow = run(locked, threads, read_percent, checksum);
+      fmt::print("{:>8} | {:>2}/{:<3} | {:>18.1f} Mop/s | {:>18.1f} Mop/s   (checksum {})\n", threads, read_percent, 100 - read_percent, fast, slow, checksum.load());
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,54 @@
+/* >=====> Flat Hash Map Benchmark <=====< */
+//=> Random 64-bit keys from 1K up to 2^max entries (argv[1], default 24): average time per
+//=> successful and failed lookup for DSA::flat_hash_map and std::unordered_map, plus insertion.
+//=> Build with: cmake -S . -B build -DCMAKE_BUILD_TYPE=Release -DBUILD_BENCHMARKS=ON
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <fmt/core.h>
+#include <flat_hash_map.hpp>
+
+using element = std::uint64_t;
+
+template<class Work>
+double measure(size_t count, Work work){
+  auto start = std::chrono::steady_clock::now();
+  work();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(stop - start).count() / count;
+}
+
+template<class Map>
+void run(const char* name, const std::unique_ptr<element[]>& keys, size_t N, const std::unique_ptr<element[]>& queries, size_t Q){
+  Map map;
+  map.reserve(N);
+  double insert = measure(N, [&]{ for(size_t i = 0; i < N; i++){ map[keys[i]] = i; } });
+
+  size_t checksum = 0;
+  double hit = measure(Q, [&]{ for(size_t q = 0; q < Q; q++){ checksum += map.find(keys[queries[q]])->second; } });
+  double miss = measure(Q, [&]{ for(size_t q = 0; q < Q; q++){ checksum += map.count(~keys[queries[q]]); } }); //=> odd keys are never inserted
+  fmt::print("{:>12} | {:>20} | {:>10.1f} ns | {:>10.1f} ns | {:>10.1f} ns   (checksum {})\n", N, name, insert, hit, miss, checksum);
+}
+
+int main(int argc, char** argv){
+  size_t max_log = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 24;
+  constexpr size_t Q = 1 << 22; //=> lookups per size
+
+  std::mt19937_64 random(42);
+  auto queries = std::make_unique<element[]>(Q);
+
+  fmt::print("{:>12} | {:>20} | {:>13} | {:>13} | {:>13}\n", "entries", "map", "insert", "hit", "miss");
+  for(size_t log = 10; log <= max_log; log += 2){
+    size_t N = size_t(1) << log;
+    auto keys = std::make_unique<element[]>(N);
+    for(size_t i = 0; i < N; i++){ keys[i] = random() << 1; } //=> even keys only
+    for(size_t q = 0; q < Q; q++){ queries[q] = random() % N; }
+
+    run<DSA::flat_hash_map<element, size_t>>("DSA::flat_hash_map", keys, N, queries, Q);
+    run<std::unordered_map<element, size_t>>("std::unordered_map", keys, N, queries, Q);
+  }
+  return 0;
+}
@@ -0,0 +1,273 @@
+#ifndef CONCURRENT_HASH_MAP_HPP
+#define CONCURRENT_HASH_MAP_HPP
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <flat_hash_map.hpp>
+
+namespace DSA{
+    using size_t = long unsigned int;
+
+    /* >=====> Concurrent Sharded Hash Map <=====< */
+    //=> The key space is split into Shards (top hash bits), each an open-addressing table with its
+    //=> own mutex for writers, so writers only contend when they hit the same shard. Readers take no
+    //=> lock: every shard carries a sequence lock (odd while a writer is inside) and a reader probes
+    //=> the table, then retries if the sequence moved under it. This needs the slots to be readable
+    //=> while being written, so optimistic reads are used when K and V are trivially copyable and
+    //=> std::atomic<K>, std::atomic<V> are lock-free; otherwise find() takes the shard mutex.
+    //=> Clearing tombstones keeps the capacity and rewrites the table in place inside a write section,
+    //=> so readers just retry. Only growth swaps in a new table; the old one is retired, not freed,
+    //=> since an optimistic reader may still be probing it, and released with the map. Growth doubles,
+    //=> so the retired tables of a shard add up to less than its current table. With locked reads
+    //=> (not optimistic) nobody can be inside an old table and it is freed at once.
+    template<class K, class V, class Hash = std::hash<K>, size_t Shards = 64>
+    class concurrent_hash_map {
+        static_assert(std::has_single_bit(Shards), "Shards must be a power of two");
+        static_assert(std::is_trivially_copyable_v<K> && std::is_trivially_copyable_v<V>, "K and V must be trivially copyable");
+
+        public:
+            //=> true when find()/contains() never block
+            static constexpr bool optimistic = std::atomic<K>::is_always_lock_free && std::atomic<V>::is_always_lock_free;
+
+        private:
+            template<class T>
+            using cell = std::conditional_t<optimistic, std::atomic<T>, T>;
+            enum : std::uint8_t { EMPTY = 0, FULL = 1, DELETED = 2 };
+            static constexpr size_t MIN_CAPACITY = 16;
+            static constexpr size_t SHARD_BITS = std::countr_zero(Shards);
+
+            template<class T>
+            static T load(const cell<T>& c) noexcept { if constexpr (optimistic){ return c.load(std::memory_order_relaxed); } else { return c; } }
+            template<class T>
+            static void store(cell<T>& c, const T& value) noexcept { if constexpr (optimistic){ c.store(value, std::memory_order_relaxed); } else { c = value; } }
+
+            struct slot {
+                cell<std::uint8_t> state{};
+                cell<K> key{};
+                cell<V> value{};
+            };
+
+            struct table {
+                size_t capacity; //=> a power of two
+                std::unique_ptr<slot[]> slots;
+                explicit table(size_t capacity) : capacity(capacity), slots(new slot[capacity]) {}
+            };
+
+            struct alignas(64) shard { //=> one cache line of header per shard, no false sharing
+                std::atomic<std::uint64_t> sequence{0}; //=> odd while a writer is modifying the table
+                std::atomic<table*> current{nullptr};
+                std::atomic<size_t> count{0};
+                size_t used = 0; //=> FULL + DELETED slots, guarded by lock
+                std::mutex lock;
+                std::vector<std::unique_ptr<table>> tables; //=> tables.back() is current, the rest are retired
+            };
+
+            std::unique_ptr<shard[]> shards;
+            [[no_unique_address]] Hash hasher;
+
+            size_t hash_of(const K& key) const { return hash_detail::mix(hasher(key)); }
+            static size_t shard_index(size_t hash) noexcept { //=> the top SHARD_BITS bits of the hash
+                if constexpr (Shards == 1){ return 0; } //=> a shift by 64 would be undefined
+                else { return hash >> (64 - SHARD_BITS); }
+            }
+            static shard& shard_of(shard* all, size_t hash) noexcept { return all[shard_index(hash)]; }
+
+            //=> slot holding key, or the first reusable slot when absent (found = false); probing is linear
+            static size_t probe(const table* t, const K& key, size_t hash, bool& found) noexcept {
+                size_t mask = t->capacity - 1, index = hash & mask, reusable = t->capacity;
+                for(size_t steps = 0; steps < t->capacity; steps++, index = (index + 1) & mask){ //=> bounded: a torn read can't spin forever
+                    std::uint8_t state = load<std::uint8_t>(t->slots[index].state);
+                    if(state == EMPTY){ found = false; return reusable != t->capacity ? reusable : index; }
+                    if(state == DELETED){ if(reusable == t->capacity){ reusable = index; } }
+                    else if(load<K>(t->slots[index].key) == key){ found = true; return index; }
+                }
+                found = false;
+                return reusable;
+            }
+
+            //=> writer side of the sequence lock, the caller holds s.lock
+            static void begin_write(shard& s) noexcept {
+                s.sequence.store(s.sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+            }
+            static void end_write(shard& s) noexcept { s.sequence.store(s.sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+            void rehash(shard& s, size_t capacity){ //=> the caller holds s.lock; the new table is private until published
+                auto fresh = std::make_unique<table>(capacity);
+                if(table* old = s.current.load(std::memory_order_relaxed)){
+                    for(size_t i = 0; i < old->capacity; i++){
+                        if(load<std::uint8_t>(old->slots[i].state) != FULL){ continue; }
+                        K key = load<K>(old->slots[i].key);
+                        bool found;
+                        size_t index = probe(fresh.get(), key, hash_of(key), found);
+                        store<std::uint8_t>(fresh->slots[index].state, FULL);
+                        store<K>(fresh->slots[index].key, key);
+                        store<V>(fresh->slots[index].value, load<V>(old->slots[i].value));
+                    }
+                }
+                s.used = s.count.load(std::memory_order_relaxed);
+                table* old = s.current.load(std::memory_order_relaxed);
+                if(old != nullptr && old->capacity == capacity){ //=> only tombstones to clear: rewrite in place, readers retry
+                    begin_write(s);
+                    for(size_t i = 0; i < capacity; i++){
+                        store<std::uint8_t>(old->slots[i].state, load<std::uint8_t>(fresh->slots[i].state));
+                        store<K>(old->slots[i].key, load<K>(fresh->slots[i].key));
+                        store<V>(old->slots[i].value, load<V>(fresh->slots[i].value));
+                    }
+                    end_write(s);
+                    return;
+                }
+                s.current.store(fresh.get(), std::memory_order_release);
+                if constexpr (!optimistic){ s.tables.clear(); } //=> readers take s.lock, none can be in the old table
+                s.tables.push_back(std::move(fresh));
+            }
+
+            //=> the caller holds s.lock; returns true when key was new
+            bool assign_locked(shard& s, const K& key, const V& value, size_t hash, bool overwrite){
+                table* t = s.current.load(std::memory_order_relaxed);
+                if(t == nullptr || (s.used + 1) * 4 > t->capacity * 3){ //=> load (with tombstones) <= 3/4
+                    size_t live = s.count.load(std::memory_order_relaxed) + 1;
+                    rehash(s, t == nullptr ? MIN_CAPACITY : live * 2 > t->capacity ? t->capacity * 2 : t->capacity);
+                    t = s.current.load(std::memory_order_relaxed);
+                }
+                bool found;
+                size_t index = probe(t, key, hash, found);
+                if(found && !overwrite){ return false; }
+                begin_write(s);
+                if(!found){
+                    if(load<std::uint8_t>(t->slots[index].state) == EMPTY){ s.used++; }
+                    store<K>(t->slots[index].key, key);
+                }
+                store<V>(t->slots[index].value, value);
+                store<std::uint8_t>(t->slots[index].state, FULL);
+                end_write(s);
+                if(!found){ s.count.fetch_add(1, std::memory_order_relaxed); }
+                return !found;
+            }
+
+        public:
+            /*assigning*/
+            concurrent_hash_map() : shards(new shard[Shards]) {}
+            explicit concurrent_hash_map(size_t count) : concurrent_hash_map() { reserve(count); }
+            concurrent_hash_map(const concurrent_hash_map&) = delete;
+            concurrent_hash_map& operator=(const concurrent_hash_map&) = delete;
+
+            //accessing || Average = O(1), lock-free when optimistic
+            std::optional<V> find(const K& key) const {
+                size_t hash = hash_of(key);
+                shard& s = shard_of(shards.get(), hash);
+                if constexpr (optimistic){
+                    for(;;){
+                        std::uint64_t before = s.sequence.load(std::memory_order_acquire);
+                        if(before & 1){ std::this_thread::yield(); continue; } //=> a writer is inside
+                        const table* t = s.current.load(std::memory_order_acquire);
+                        if(t == nullptr){ return std::nullopt; }
+                        bool found;
+                        size_t index = probe(t, key, hash, found);
+                        V value = found ? load<V>(t->slots[index].value) : V{};
+                        std::atomic_thread_fence(std::memory_order_acquire);
+                        if(s.sequence.load(std::memory_order_relaxed) == before){
+                            return found ? std::optional<V>(value) : std::nullopt;
+                        }
+                    }
+                }
+                else {
+                    std::lock_guard<std::mutex> guard(s.lock);
+                    const table* t = s.current.load(std::memory_order_relaxed);
+                    if(t == nullptr){ return std::nullopt; }
+                    bool found;
+                    size_t index = probe(t, key, hash, found);
+                    return found ? std::optional<V>(load<V>(t->slots[index].value)) : std::nullopt;
+                }
+            }
+            bool contains(const K& key) const { return find(key).has_value(); }
+
+            //inserting || Average = O(1), one shard lock
+            bool insert(const K& key, const V& value){ //=> keeps an existing value, true when inserted
+                size_t hash = hash_of(key);
+                shard& s = shard_of(shards.get(), hash);
+                std::lock_guard<std::mutex> guard(s.lock);
+                return assign_locked(s, key, value, hash, false);
+            }
+            bool insert_or_assign(const K& key, const V& value){ //=> true when inserted, false when assigned
+                size_t hash = hash_of(key);
+                shard& s = shard_of(shards.get(), hash);
+                std::lock_guard<std::mutex> guard(s.lock);
+                return assign_locked(s, key, value, hash, true);
+            }
+
+            //=> Batched version: the items are bucketed by shard first, so every shard's lock is taken
+            //=> once for all of its items instead of once per item. Returns the number of new keys.
+            size_t insert_or_assign(const std::pair<K, V>* items, size_t count){
+                std::vector<size_t> hashes(count), order(count), start(Shards + 1, 0);
+                for(size_t i = 0; i < count; i++){
+                    hashes[i] = hash_of(items[i].first);
+                    start[shard_index(hashes[i]) + 1]++;
+                }
+                for(size_t i = 0; i < Shards; i++){ start[i + 1] += start[i]; }
+                std::vector<size_t> next(start.begin(), start.end() - 1);
+                for(size_t i = 0; i < count; i++){ order[next[shard_index(hashes[i])]++] = i; } //=> counting sort, input order kept per shard
+
+                size_t inserted = 0;
+                for(size_t group = 0; group < Shards; group++){
+                    if(start[group] == start[group + 1]){ continue; }
+                    shard& s = shards[group];
+                    std::lock_guard<std::mutex> guard(s.lock);
+                    for(size_t i = start[group]; i < start[group + 1]; i++){
+                        const std::pair<K, V>& item = items[order[i]];
+                        inserted += assign_locked(s, item.first, item.second, hashes[order[i]], true);
+                    }
+                }
+                return inserted;
+            }
+            template<size_t N>
+            size_t insert_or_assign(const std::pair<K, V> (&items)[N]){ return insert_or_assign(items, N); } //=> (&items)[N] is an array reference, not a pointer.
+
+            //erasing || Average = O(1), leaves a tombstone
+            bool erase(const K& key){
+                size_t hash = hash_of(key);
+                shard& s = shard_of(shards.get(), hash);
+                std::lock_guard<std::mutex> guard(s.lock);
+                table* t = s.current.load(std::memory_order_relaxed);
+                if(t == nullptr){ return false; }
+                bool found;
+                size_t index = probe(t, key, hash, found);
+                if(!found){ return false; }
+                begin_write(s);
+                store<std::uint8_t>(t->slots[index].state, DELETED);
+                end_write(s);
+                s.count.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+
+            //size and capacity
+            size_t size(void) const noexcept { //=> a snapshot, exact only while no writer runs
+                size_t total = 0;
+                for(size_t i = 0; i < Shards; i++){ total += shards[i].count.load(std::memory_order_relaxed); }
+                return total;
+            }
+            bool empty(void) const noexcept { return size() == 0; }
+            void reserve(size_t count){ //=> sizes every shard for an even share of count elements
+                size_t per_shard = (count + Shards - 1) / Shards;
+                size_t capacity = std::bit_ceil(per_shard * 4 / 3 + 1);
+                if(capacity < MIN_CAPACITY){ capacity = MIN_CAPACITY; }
+                for(size_t i = 0; i < Shards; i++){
+                    std::lock_guard<std::mutex> guard(shards[i].lock);
+                    table* t = shards[i].current.load(std::memory_order_relaxed);
+                    if(t == nullptr || t->capacity < capacity){ rehash(shards[i], capacity); }
+                }
+            }
+            static constexpr size_t shard_count(void) noexcept { return Shards; }
+    };
+}
+#endif
@@ -0,0 +1,450 @@
+#ifndef FLAT_HASH_MAP_HPP
+#define FLAT_HASH_MAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <bit>
+#include <utility>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#if defined(__SSE2__) || defined(_M_X64)
+  #include <emmintrin.h>
+  #define DSA_HASH_SSE2 1
+#endif
+
+namespace DSA{
+    using size_t = long unsigned int;
+
+    /* >=====> SwissTable-Style Open Addressing <=====< */
+    //=> Every slot has a control byte: EMPTY, DELETED, or the low 7 bits of the key's hash (H2) when
+    //=> full. Slots come in aligned groups of 16, so one SSE2 compare of a group's control bytes
+    //=> against H2 yields a 16-bit mask of candidate slots; the keys themselves are only compared
+    //=> on a tag match (1 in 128 false positives). The upper hash bits (H1) pick the first group and
+    //=> probing moves group by group (triangular steps) until a group with an EMPTY byte is seen.
+    namespace hash_detail {
+        using ctrl_t = signed char;
+        constexpr ctrl_t EMPTY = -128; //=> 0b10000000
+        constexpr ctrl_t DELETED = -2; //=> 0b11111110, a tombstone
+        constexpr size_t GROUP = 16; //=> slots per group (one SSE2 register of control bytes)
+
+        //=> std::hash is the identity for integers, so the bits are mixed before H1/H2 are split off
+        constexpr size_t mix(size_t h) noexcept {
+            h ^= h >> 33; h *= 0xff51afd7ed558ccdull;
+            h ^= h >> 33; h *= 0xc4ceb9fe1a85ec53ull;
+            return h ^ (h >> 33);
+        }
+
+        struct group { //=> a view of 16 control bytes
+            const ctrl_t* ctrl;
+#if defined(DSA_HASH_SSE2)
+            unsigned match(ctrl_t h2) const noexcept { //=> bit i set when slot i carries tag h2
+                __m128i bytes = _mm_load_si128(reinterpret_cast<const __m128i*>(ctrl));
+                return unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), bytes)));
+            }
+            unsigned empty(void) const noexcept { return match(EMPTY); }
+            unsigned free(void) const noexcept { //=> EMPTY or DELETED: the sign bit is set
+                return unsigned(_mm_movemask_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(ctrl))));
+            }
+#else
+            unsigned match(ctrl_t h2) const noexcept {
+                unsigned mask = 0;
+                for(size_t i = 0; i < GROUP; i++){ mask |= unsigned(ctrl[i] == h2) << i; }
+                return mask;
+            }
+            unsigned empty(void) const noexcept { return match(EMPTY); }
+            unsigned free(void) const noexcept {
+                unsigned mask = 0;
+                for(size_t i = 0; i < GROUP; i++){ mask |= unsigned(ctrl[i] < 0) << i; }
+                return mask;
+            }
+#endif
+        };
+
+        template<class K, class V>
+        struct map_policy { //=> slots are key/value pairs
+            using key_type = K;
+            using slot_type = std::pair<const K, V>;
+            static const K& key(const slot_type& slot) noexcept { return slot.first; }
+            static void relocate(slot_type* to, slot_type* from){ //=> the old slot is destroyed right after, so its key can be moved from
+                ::new (static_cast<void*>(to)) slot_type(std::move(const_cast<K&>(from->first)), std::move(from->second));
+                from->~slot_type();
+            }
+        };
+
+        template<class K>
+        struct set_policy { //=> slots are the keys themselves
+            using key_type = K;
+            using slot_type = K;
+            static const K& key(const slot_type& slot) noexcept { return slot; }
+            static void relocate(slot_type* to, slot_type* from){
+                ::new (static_cast<void*>(to)) slot_type(std::move(*from));
+                from->~slot_type();
+            }
+        };
+
+        template<class H, class E, class = void>
+        constexpr bool transparent = false;
+        template<class H, class E>
+        constexpr bool transparent<H, E, std::void_t<typename H::is_transparent, typename E::is_transparent>> = true;
+
+        template<class Policy, class Hash, class Eq>
+        class raw_table {
+            public:
+                using key_type = typename Policy::key_type;
+                using slot_type = typename Policy::slot_type;
+
+            private:
+                static constexpr size_t ALIGNMENT = alignof(slot_type) > GROUP ? alignof(slot_type) : GROUP;
+
+                ctrl_t* ctrl = nullptr; //=> capacity control bytes, then (aligned) the slots
+                slot_type* slots = nullptr;
+                size_t capacity_ = 0; //=> 0 or a power of two >= GROUP
+                size_t size_ = 0;
+                size_t growth_left = 0; //=> inserts into EMPTY slots left before a rehash (load <= 7/8)
+                [[no_unique_address]] Hash hasher;
+                [[no_unique_address]] Eq equal;
+
+                static size_t slots_offset(size_t capacity) noexcept { return (capacity + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT; }
+                static size_t bytes_for(size_t capacity) noexcept { return slots_offset(capacity) + capacity * sizeof(slot_type); }
+
+                void allocate(size_t capacity){ //=> all control bytes EMPTY
+                    void* memory = ::operator new(bytes_for(capacity), std::align_val_t{ALIGNMENT});
+                    ctrl = static_cast<ctrl_t*>(memory);
+                    slots = reinterpret_cast<slot_type*>(static_cast<char*>(memory) + slots_offset(capacity));
+                    std::memset(ctrl, EMPTY, capacity);
+                    capacity_ = capacity;
+                    growth_left = capacity - capacity / 8;
+                }
+
+                void release(void) noexcept {
+                    if(ctrl == nullptr){ return; }
+                    if constexpr (!std::is_trivially_destructible_v<slot_type>){
+                        for(size_t i = 0; i < capacity_; i++){ if(ctrl[i] >= 0){ slots[i].~slot_type(); } }
+                    }
+                    ::operator delete(ctrl, std::align_val_t{ALIGNMENT});
+                    ctrl = nullptr; slots = nullptr; capacity_ = 0; size_ = 0; growth_left = 0;
+                }
+
+                template<class Q>
+                size_t hash_of(const Q& key) const { return mix(hasher(key)); }
+
+                //=> first free (EMPTY or DELETED) slot on the probe sequence of hash
+                size_t free_slot(size_t hash) const noexcept {
+                    size_t groups_mask = capacity_ / GROUP - 1, g = (hash >> 7) & groups_mask;
+                    for(size_t step = 1; ; step++){
+                        unsigned mask = group{ctrl + g * GROUP}.free();
+                        if(mask){ return g * GROUP + std::countr_zero(mask); }
+                        g = (g + step) & groups_mask;
+                    }
+                }
+
+                void rehash_into(size_t capacity){
+                    ctrl_t* old_ctrl = ctrl;
+                    slot_type* old_slots = slots;
+                    size_t old_capacity = capacity_, count = size_;
+                    allocate(capacity);
+                    for(size_t i = 0; i < old_capacity; i++){
+                        if(old_ctrl[i] < 0){ continue; }
+                        size_t hash = hash_of(Policy::key(old_slots[i]));
+                        size_t slot = free_slot(hash);
+                        ctrl[slot] = ctrl_t(hash & 0x7F);
+                        Policy::relocate(slots + slot, old_slots + i);
+                    }
+                    size_ = count;
+                    growth_left -= count;
+                    if(old_ctrl != nullptr){ ::operator delete(old_ctrl, std::align_val_t{ALIGNMENT}); }
+                }
+
+                static size_t capacity_for(size_t count) noexcept { //=> smallest power of two holding count at load 7/8
+                    size_t needed = count + (count + 6) / 7;
+                    return needed <= GROUP ? GROUP : std::bit_ceil(needed);
+                }
+
+            public:
+                /*assigning*/
+                raw_table() = default;
+                explicit raw_table(size_t count){ reserve(count); }
+                raw_table(const raw_table& other) : hasher(other.hasher), equal(other.equal) {
+                    if(other.size_ == 0){ return; }
+                    allocate(capacity_for(other.size_));
+                    for(size_t i = 0; i < other.capacity_; i++){
+                        if(other.ctrl[i] < 0){ continue; }
+                        size_t hash = hash_of(Policy::key(other.slots[i]));
+                        size_t slot = free_slot(hash);
+                        ::new (static_cast<void*>(slots + slot)) slot_type(other.slots[i]);
+                        ctrl[slot] = ctrl_t(hash & 0x7F);
+                        size_++; growth_left--;
+                    }
+                }
+                raw_table(raw_table&& other) noexcept
+                    : ctrl(std::exchange(other.ctrl, nullptr)), slots(std::exchange(other.slots, nullptr)),
+                      capacity_(std::exchange(other.capacity_, 0)), size_(std::exchange(other.size_, 0)),
+                      growth_left(std::exchange(other.growth_left, 0)), hasher(std::move(other.hasher)), equal(std::move(other.equal)) {}
+                raw_table& operator=(raw_table other) noexcept { swap(other); return *this; } //=> copy (or move) and swap
+                ~raw_table(){ release(); }
+
+                void swap(raw_table& other) noexcept {
+                    std::swap(ctrl, other.ctrl); std::swap(slots, other.slots); std::swap(capacity_, other.capacity_);
+                    std::swap(size_, other.size_); std::swap(growth_left, other.growth_left);
+                    std::swap(hasher, other.hasher); std::swap(equal, other.equal);
+                }
+
+                //iterating (over full slots, in table order)
+                template<bool Const>
+                class basic_iterator {
+                    friend class raw_table;
+                    friend class basic_iterator<!Const>;
+                    using table_ptr = std::conditional_t<Const, const raw_table*, raw_table*>;
+                    table_ptr table = nullptr;
+                    size_t index = 0;
+                    basic_iterator(table_ptr table, size_t index) noexcept : table(table), index(index) { skip(); }
+                    void skip(void) noexcept { while(index < table->capacity_ && table->ctrl[index] < 0){ index++; } }
+                public:
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type = slot_type;
+                    using difference_type = std::ptrdiff_t;
+                    using reference = std::conditional_t<Const, const slot_type&, slot_type&>;
+                    using pointer = std::conditional_t<Const, const slot_type*, slot_type*>;
+
+                    basic_iterator() = default;
+                    operator basic_iterator<true>() const noexcept { return basic_iterator<true>(table, index); }
+                    reference operator*() const noexcept { return table->slots[index]; }
+                    pointer operator->() const noexcept { return table->slots + index; }
+                    basic_iterator& operator++() noexcept { index++; skip(); return *this; }
+                    basic_iterator operator++(int) noexcept { basic_iterator old = *this; ++*this; return old; }
+                    friend bool operator==(const basic_iterator& a, const basic_iterator& b) noexcept { return a.index == b.index; }
+                };
+                using iterator = basic_iterator<false>;
+                using const_iterator = basic_iterator<true>;
+
+                iterator begin(void) noexcept { return iterator(this, 0); }
+                const_iterator begin(void) const noexcept { return const_iterator(this, 0); }
+                iterator end(void) noexcept { return iterator(this, capacity_); }
+                const_iterator end(void) const noexcept { return const_iterator(this, capacity_); }
+
+                //searching || Average = O(1), one SSE2 compare per group visited
+                template<class Q>
+                size_t find_index(const Q& key) const { //=> slot index, or capacity() if absent
+                    return size_ == 0 ? capacity_ : find_hashed(key, hash_of(key));
+                }
+
+                template<class Q>
+                size_t find_hashed(const Q& key, size_t hash) const {
+                    ctrl_t h2 = ctrl_t(hash & 0x7F);
+                    size_t groups_mask = capacity_ / GROUP - 1, g = (hash >> 7) & groups_mask;
+                    for(size_t step = 1; ; step++){
+                        group current{ctrl + g * GROUP};
+                        for(unsigned mask = current.match(h2); mask; mask &= mask - 1){
+                            size_t slot = g * GROUP + std::countr_zero(mask);
+                            if(equal(Policy::key(slots[slot]), key)){ return slot; }
+                        }
+                        if(current.empty()){ return capacity_; } //=> an EMPTY byte ends every probe sequence
+                        g = (g + step) & groups_mask;
+                    }
+                }
+
+                template<class Q>
+                iterator find(const Q& key){ return iterator(this, find_index(key)); }
+                template<class Q>
+                const_iterator find(const Q& key) const { return const_iterator(this, find_index(key)); }
+
+                //inserting || Average = O(1), amortized over rehashes
+                template<class Q, class... Args> //=> constructs slot_type(args...) only when key is absent
+                std::pair<iterator, bool> emplace_key(const Q& key, Args&&... args){
+                    size_t hash = hash_of(key);
+                    size_t found = size_ == 0 ? capacity_ : find_hashed(key, hash);
+                    if(found != capacity_){ return {iterator(this, found), false}; }
+
+                    if(capacity_ == 0){ rehash_into(GROUP); }
+                    size_t slot = free_slot(hash);
+                    if(growth_left == 0 && ctrl[slot] == EMPTY){
+                        //=> mostly tombstones: rebuild at the same size, otherwise double
+                        rehash_into(size_ < capacity_ * 7 / 16 ? capacity_ : capacity_ * 2);
+                        slot = free_slot(hash);
+                    }
+                    ::new (static_cast<void*>(slots + slot)) slot_type(std::forward<Args>(args)...);
+                    if(ctrl[slot] == EMPTY){ growth_left--; }
+                    ctrl[slot] = ctrl_t(hash & 0x7F);
+                    size_++;
+                    return {iterator(this, slot), true};
+                }
+
+                //erasing || Average = O(1)
+                //=> A probe sequence only continues past groups without an EMPTY byte. If the slot's
+                //=> group still has one, nothing can be probing through it and the slot goes back to
+                //=> EMPTY; only an erase from a full group leaves a tombstone behind.
+                void erase_index(size_t slot){
+                    slots[slot].~slot_type();
+                    if(group{ctrl + slot / GROUP * GROUP}.empty()){
+                        ctrl[slot] = EMPTY;
+                        growth_left++;
+                    }
+                    else { ctrl[slot] = DELETED; }
+                    size_--;
+                }
+
+                template<class Q>
+                size_t erase_key(const Q& key){
+                    size_t slot = find_index(key);
+                    if(slot == capacity_){ return 0; }
+                    erase_index(slot);
+                    return 1;
+                }
+
+                //size and capacity
+                size_t size(void) const noexcept { return size_; }
+                bool empty(void) const noexcept { return size_ == 0; }
+                size_t capacity(void) const noexcept { return capacity_; }
+                float load_factor(void) const noexcept { return capacity_ ? float(size_) / float(capacity_) : 0.0f; }
+                void reserve(size_t count){ if(capacity_for(count) > capacity_){ rehash_into(capacity_for(count)); } } //=> no rehash until count elements
+                void clear(void) noexcept { release(); }
+        };
+    }
+
+    /* >=====> Flat Hash Map <=====< */
+    template<class K, class V, class Hash = std::hash<K>, class Eq = std::equal_to<K>>
+    class flat_hash_map {
+        private:
+            using table_type = hash_detail::raw_table<hash_detail::map_policy<K, V>, Hash, Eq>;
+            table_type table;
+
+        public:
+            using key_type = K;
+            using mapped_type = V;
+            using value_type = std::pair<const K, V>;
+            using iterator = typename table_type::iterator;
+            using const_iterator = typename table_type::const_iterator;
+
+            /*assigning*/
+            flat_hash_map() = default;
+            explicit flat_hash_map(size_t count) : table(count) {} //=> reserves room for count elements
+            flat_hash_map(std::initializer_list<value_type> list){ //=> assigning with a list
+                table.reserve(list.size());
+                for(const value_type& element : list){ insert(element); }
+            }
+
+            //accessing
+            iterator find(const K& key){ return table.find(key); }
+            const_iterator find(const K& key) const { return table.find(key); }
+            bool contains(const K& key) const { return table.find_index(key) != table.capacity(); }
+            size_t count(const K& key) const { return contains(key); }
+            //=> heterogeneous lookup (e.g. std::string_view into std::string keys) with a transparent Hash and Eq
+            template<class Q> requires hash_detail::transparent<Hash, Eq>
+            iterator find(const Q& key){ return table.find(key); }
+            template<class Q> requires hash_detail::transparent<Hash, Eq>
+            const_iterator find(const Q& key) const { return table.find(key); }
+            template<class Q> requires hash_detail::transparent<Hash, Eq>
+            bool contains(const Q& key) const { return table.find_index(key) != table.capacity(); }
+            template<class Q> requires hash_detail::transparent<Hash, Eq>
+            size_t count(const Q& key) const { return contains(key); }
+
+            V& at(const K& key){ // access by a function with an exception
+                iterator found = table.find(key);
+                if(found == table.end()){ throw std::out_of_range("Error: Key is not found!"); }
+                return found->second;
+            }
+            const V& at(const K& key) const { // access by a function with an exception
+                const_iterator found = table.find(key);
+                if(found == table.end()){ throw std::out_of_range("Error: Key is not found!"); }
+                return found->second;
+            }
+            V& operator[](const K& key){ return try_emplace(key).first->second; } //=> default-inserts a missing key
+
+            //inserting
+            std::pair<iterator, bool> insert(const value_type& element){ return table.emplace_key(element.first, element); }
+            std::pair<iterator, bool> insert(value_type&& element){ return table.emplace_key(element.first, std::move(element)); }
+            template<class... Args>
+            std::pair<iterator, bool> try_emplace(const K& key, Args&&... args){ //=> builds V only if key is new
+                return table.emplace_key(key, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+            }
+            template<class... Args>
+            std::pair<iterator, bool> emplace(const K& key, Args&&... args){ return try_emplace(key, std::forward<Args>(args)...); }
+            template<class M>
+            std::pair<iterator, bool> insert_or_assign(const K& key, M&& value){
+                auto result = try_emplace(key, std::forward<M>(value));
+                if(!result.second){ result.first->second = std::forward<M>(value); }
+                return result;
+            }
+
+            //erasing
+            size_t erase(const K& key){ return table.erase_key(key); }
+            template<class Q> requires hash_detail::transparent<Hash, Eq>
+            size_t erase(const Q& key){ return table.erase_key(key); }
+            void clear(void) noexcept { table.clear(); }
+
+            //iterating
+            iterator begin(void) noexcept { return table.begin(); }
+            const_iterator begin(void) const noexcept { return table.begin(); }
+            iterator end(void) noexcept { return table.end(); }
+            const_iterator end(void) const noexcept { return table.end(); }
+
+            //size and capacity
+            size_t size(void) const noexcept { return table.size(); }
+            bool empty(void) const noexcept { return table.empty(); }
+            size_t capacity(void) const noexcept { return table.capacity(); }
+            float load_factor(void) const noexcept { return table.load_factor(); }
+            void reserve(size_t count){ table.reserve(count); }
+            void swap(flat_hash_map& other) noexcept { table.swap(other.table); }
+    };
+
+    /* >=====> Flat Hash Set <=====< */
+    template<class K, class Hash = std::hash<K>, class Eq = std::equal_to<K>>
+    class flat_hash_set {
+        private:
+            using table_type = hash_detail::raw_table<hash_detail::set_policy<K>, Hash, Eq>;
+            table_type table;
+
+        public:
+            using key_type = K;
+            using value_type = K;
+            using iterator = typename table_type::const_iterator; //=> keys are never modified in place
+            using const_iterator = typename table_type::const_iterator;
+
+            /*assigning*/
+            flat_hash_set() = default;
+            explicit flat_hash_set(size_t count) : table(count) {} //=> reserves room for count elements
+            flat_hash_set(std::initializer_list<K> list){ //=> assigning with a list
+                table.reserve(list.size());
+                for(const K& element : list){ insert(element); }
+            }
+
+            //accessing
+            const_iterator find(const K& key) const { return table.find(key); }
+            bool contains(const K& key) const { return table.find_index(key) != table.capacity(); }
+            size_t count(const K& key) const { return contains(key); }
+            //=> heterogeneous lookup with a transparent Hash and Eq
+            template<class Q> requires hash_detail::transparent<Hash, Eq>
+            const_iterator find(const Q& key) const { return table.find(key); }
+            template<class Q> requires hash_detail::transparent<Hash, Eq>
+            bool contains(const Q& key) const { return table.find_index(key) != table.capacity(); }
+            template<class Q> requires hash_detail::transparent<Hash, Eq>
+            size_t count(const Q& key) const { return contains(key); }
+
+            //inserting
+            std::pair<const_iterator, bool> insert(const K& key){ return table.emplace_key(key, key); }
+            std::pair<const_iterator, bool> insert(K&& key){ return table.emplace_key(key, std::move(key)); }
+
+            //erasing
+            size_t erase(const K& key){ return table.erase_key(key); }
+            template<class Q> requires hash_detail::transparent<Hash, Eq>
+            size_t erase(const Q& key){ return table.erase_key(key); }
+            void clear(void) noexcept { table.clear(); }
+
+            //iterating
+            const_iterator begin(void) const noexcept { return table.begin(); }
+            const_iterator end(void) const noexcept { return table.end(); }
+
+            //size and capacity
+            size_t size(void) const noexcept { return table.size(); }
+            bool empty(void) const noexcept { return table.empty(); }
+            size_t capacity(void) const noexcept { return table.capacity(); }
+            float load_factor(void) const noexcept { return table.load_factor(); }
+            void reserve(size_t count){ table.reserve(count); }
+            void swap(flat_hash_set& other) noexcept { table.swap(other.table); }
+    };
+}
+#endif
@@ -0,0 +1,165 @@
+#ifndef PERFECT_HASH_HPP
+#define PERFECT_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <DS/array/array.hpp> //=> for DSA::array
+#include <flat_hash_map.hpp> //=> for hash_detail::mix
+
+namespace DSA{
+    using size_t = long unsigned int;
+
+    /* >=====> Compile-Time Hashing <=====< */
+    //=> std::hash is not constexpr, so the perfect hash brings its own: integers and enums are mixed,
+    //=> std::string_view goes through 64-bit FNV-1a and is mixed after. Specialize for other keys.
+    template<class K, class = void>
+    struct constexpr_hash;
+
+    template<class K>
+    struct constexpr_hash<K, std::enable_if_t<std::is_integral_v<K> || std::is_enum_v<K>>> {
+        constexpr std::uint64_t operator()(K key) const noexcept { return hash_detail::mix(std::uint64_t(key)); }
+    };
+
+    template<>
+    struct constexpr_hash<std::string_view> {
+        constexpr std::uint64_t operator()(std::string_view key) const noexcept {
+            std::uint64_t h = 0xcbf29ce484222325ull;
+            for(char c : key){ h = (h ^ std::uint8_t(c)) * 0x100000001b3ull; }
+            return hash_detail::mix(h);
+        }
+    };
+
+    /* >=====> Perfect Hash (CHD / PTHash Style) <=====< */
+    //=> Built once from a DSA::array of N distinct keys, usually in a constexpr variable so that the
+    //=> whole table is computed by the compiler and lives in read-only data:
+    //=>     constexpr DSA::array<std::string_view, 3> names{"get", "put", "delete"};
+    //=>     constexpr DSA::perfect_hash lookup(names); //=> lookup.find("put") == 1
+    //=> The keys are split into ~N/4 buckets by hash. Buckets are placed largest first: each gets the
+    //=> first "pilot" p for which all of its keys land on distinct free slots of the table, at slot
+    //=> mix(hash ^ p) over M = N + N/8 + 1 slots. A lookup is then one bucket read (its pilot), one
+    //=> slot read and one key compare: no probing and no collisions.
+    template<class K, size_t N, class Hash = constexpr_hash<K>>
+    class perfect_hash {
+        public:
+            static constexpr size_t BUCKETS = N / 4 + 1;
+            static constexpr size_t SLOTS = N + N / 8 + 1;
+        private:
+            static constexpr std::uint32_t EMPTY = std::uint32_t(-1);
+            static constexpr std::uint32_t MAX_PILOT = 1u << 20; //=> far past what any bucket needs
+
+            DSA::array<std::uint32_t, BUCKETS> pilots;
+            DSA::array<K, SLOTS> keys; //=> key stored in each slot
+            DSA::array<std::uint32_t, SLOTS> indices; //=> its index in the source array, EMPTY if none
+
+            //=> multiply-shift range reduction of 32 hash bits onto [0, range)
+            static constexpr size_t reduce(std::uint64_t bits, size_t range) noexcept { return size_t(((bits & 0xFFFFFFFFull) * range) >> 32); }
+            static constexpr size_t bucket_of(std::uint64_t hash) noexcept { return reduce(hash >> 32, BUCKETS); }
+            static constexpr size_t slot_of(std::uint64_t hash, std::uint32_t pilot) noexcept {
+                return reduce(hash_detail::mix(hash ^ (std::uint64_t(pilot) * 0x9E3779B97F4A7C15ull)), SLOTS);
+            }
+
+        public:
+            /*assigning*/
+            template<size_t A>
+            constexpr explicit perfect_hash(const DSA::array<K, N, A>& source) : pilots{}, keys{}, indices{} { //=> O(N) expected, throws on duplicate keys
+                DSA::array<std::uint64_t, N> hashes{};
+                DSA::array<size_t, BUCKETS + 1> start{}; //=> keys of bucket b are members[start[b] .. start[b + 1])
+                DSA::array<size_t, N> members{};
+                for(size_t i = 0; i < N; i++){
+                    hashes[i] = Hash{}(source[i]);
+                    start[bucket_of(hashes[i]) + 1]++;
+                }
+                for(size_t b = 0; b < BUCKETS; b++){ start[b + 1] += start[b]; }
+                DSA::array<size_t, BUCKETS + 1> next = start;
+                for(size_t i = 0; i < N; i++){ members[next[bucket_of(hashes[i])]++] = i; }
+
+                //=> counting sort of the buckets by size, largest first (they are the hardest to place)
+                DSA::array<size_t, N + 2> by_size{};
+                for(size_t b = 0; b < BUCKETS; b++){ by_size[N - (start[b + 1] - start[b]) + 1]++; }
+                for(size_t s = 0; s <= N; s++){ by_size[s + 1] += by_size[s]; }
+                DSA::array<size_t, BUCKETS> order{};
+                for(size_t b = 0; b < BUCKETS; b++){ order[by_size[N - (start[b + 1] - start[b])]++] = b; }
+
+                for(size_t i = 0; i < SLOTS; i++){ indices[i] = EMPTY; }
+                for(size_t o = 0; o < BUCKETS; o++){
+                    size_t b = order[o], first = start[b], last = start[b + 1];
+                    if(first == last){ break; } //=> only empty buckets are left
+                    for(size_t i = first; i < last; i++){ //=> equal hashes never separate, whatever the pilot
+                        for(size_t j = i + 1; j < last; j++){
+                            if(hashes[members[i]] != hashes[members[j]]){ continue; }
+                            if(source[members[i]] == source[members[j]]){ throw std::invalid_argument("Error: Keys are not unique!"); }
+                            throw std::invalid_argument("Error: Two keys have the same hash!");
+                        }
+                    }
+                    std::uint32_t pilot = 0;
+                    for(;; pilot++){
+                        if(pilot == MAX_PILOT){ throw std::length_error("Error: No pilot is found!"); }
+                        size_t placed = first;
+                        for(; placed < last; placed++){ //=> claim slots, undo on the first clash
+                            size_t slot = slot_of(hashes[members[placed]], pilot);
+                            if(indices[slot] != EMPTY){ break; }
+                            indices[slot] = std::uint32_t(members[placed]);
+                        }
+                        if(placed == last){ break; }
+                        for(size_t i = first; i < placed; i++){ indices[slot_of(hashes[members[i]], pilot)] = EMPTY; }
+                    }
+                    pilots[b] = pilot;
+                    for(size_t i = first; i < last; i++){ keys[slot_of(hashes[members[i]], pilot)] = source[members[i]]; }
+                }
+            }
+
+            //searching || Worst = Average = Best = O(1), one probe
+            constexpr size_t find(const K& key) const noexcept { //=> index of key in the source array, or -1 like linear::linear_search
+                std::uint64_t hash = Hash{}(key);
+                size_t slot = slot_of(hash, pilots[bucket_of(hash)]);
+                return (indices[slot] != EMPTY && keys[slot] == key) ? indices[slot] : size_t(-1);
+            }
+            constexpr bool contains(const K& key) const noexcept { return find(key) != size_t(-1); }
+
+            //size and capacity
+            static constexpr size_t size(void) noexcept { return N; }
+            static constexpr size_t capacity(void) noexcept { return SLOTS; }
+            static constexpr size_t size_in_bytes(void) noexcept { return sizeof(perfect_hash); }
+    };
+
+    /* >=====> Perfect Hash Map <=====< */
+    //=> A perfect_hash over the keys plus the values in source order, e.g. a dispatch table:
+    //=>     constexpr DSA::perfect_hash_map commands(names, DSA::array<handler, 3>{on_get, on_put, on_delete});
+    template<class K, class V, size_t N, class Hash = constexpr_hash<K>>
+    class perfect_hash_map {
+        private:
+            perfect_hash<K, N, Hash> index;
+            DSA::array<V, N> values;
+
+            template<size_t B>
+            static constexpr DSA::array<V, N> stored(const DSA::array<V, N, B>& values){ //=> the values at their natural alignment
+                if constexpr (B == alignof(V)){ return values; }
+                else { return [&values]<size_t... I>(std::index_sequence<I...>){ return DSA::array<V, N>{values[I]...}; }(std::make_index_sequence<N>{}); }
+            }
+
+        public:
+            /*assigning*/
+            template<size_t A, size_t B> //=> any alignment of the source arrays, e.g. DSA::array<K, N, 64>
+            constexpr perfect_hash_map(const DSA::array<K, N, A>& keys, const DSA::array<V, N, B>& values) : index(keys), values(stored(values)) {}
+
+            //accessing || O(1), one probe
+            constexpr const V* find(const K& key) const noexcept { //=> nullptr when key is absent
+                size_t i = index.find(key);
+                return i == size_t(-1) ? nullptr : &values[i];
+            }
+            constexpr bool contains(const K& key) const noexcept { return index.contains(key); }
+            constexpr const V& at(const K& key) const { // access by a function with an exception
+                size_t i = index.find(key);
+                if(i == size_t(-1)){ throw std::out_of_range("Error: Key is not found!"); }
+                return values[i];
+            }
+
+            //size and capacity
+            static constexpr size_t size(void) noexcept { return N; }
+    };
+}
+#endif
@@ -0,0 +1,71 @@
+/* >=====> Perfect Hash Tests <=====< */
+//=> Builds perfect_hash over N distinct random keys (N from 1 to 5000) and compares find() with
+//=> std::find over the source keys, for every stored key and for keys that are not stored. Also:
+//=> a table built by the compiler (static_assert), perfect_hash_map over aligned source arrays,
+//=> at() on a missing key and duplicate keys, which must throw. Registered with ctest.
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+#include <fmt/core.h>
+#include <perfect_hash.hpp>
+
+constexpr DSA::array<std::string_view, 4> names{"get", "put", "delete", "post"};
+constexpr DSA::perfect_hash compiled(names);
+static_assert(compiled.find("delete") == 2 && compiled.find("patch") == size_t(-1));
+
+template<size_t N>
+bool table_matches(std::mt19937_64& random){
+  std::vector<long> pool(3 * N); //=> every third one is stored, the rest are the misses
+  std::iota(pool.begin(), pool.end(), 0L);
+  for(long& key : pool){ key = key * 2654435761L - long(N); }
+  std::shuffle(pool.begin(), pool.end(), random);
+
+  DSA::array<long, N> keys{};
+  for(size_t i = 0; i < N; i++){ keys[i] = pool[i]; }
+  DSA::perfect_hash<long, N> table(keys);
+  for(long key : pool){
+    size_t index = size_t(std::find(keys.begin(), keys.end(), key) - keys.begin());
+    if(table.find(key) != (index < N ? index : size_t(-1)) || table.contains(key) != (index < N)){ return false; }
+  }
+  return true;
+}
+
+bool hash_matches_find(void){
+  std::mt19937_64 random(3);
+  return table_matches<1>(random) && table_matches<3>(random) && table_matches<64>(random)
+      && table_matches<1000>(random) && table_matches<5000>(random);
+}
+
+bool map_matches_source(void){
+  DSA::array<long, 5, 64> keys{40, 7, -3, 1000000, 12};
+  DSA::array<int, 5, 32> values{1, 2, 3, 4, 5};
+  DSA::perfect_hash_map<long, int, 5> map(keys, values);
+  for(size_t i = 0; i < 5; i++){
+    if(map.find(keys[i]) == nullptr || *map.find(keys[i]) != values[i] || map.at(keys[i]) != values[i]){ return false; }
+  }
+  bool missing = false;
+  try { map.at(8); } catch(const std::out_of_range&){ missing = true; }
+  return missing && map.find(8) == nullptr && !map.contains(-4);
+}
+
+bool duplicates_throw(void){
+  DSA::array<long, 4> keys{1, 2, 3, 2};
+  try { DSA::perfect_hash<long, 4> table(keys); } catch(const std::invalid_argument&){ return true; }
+  return false;
+}
+
+int main(void){
+  int failed = 0;
+  auto check = [&failed](const char* name, bool passed){
+    fmt::print("{:>48} | {}\n", name, passed ? "ok" : "FAILED");
+    failed += !passed;
+  };
+  check("perfect_hash == std::find", hash_matches_find());
+  check("perfect_hash_map == its source arrays", map_matches_source());
+  check("perfect_hash rejects duplicate keys", duplicates_throw());
+  return failed ? 1 : 0;
+}
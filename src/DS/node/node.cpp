@@ -477,6 +477,22 @@ template <class T> const Node<T> &Node<T>::getRight(void) const {
   return *this->right;
 }
 
+/**
+ * @brief Check if the node has a left child
+ * @return true if the left child is not nullptr
+ */
+template <class T> bool Node<T>::hasLeft(void) const noexcept {
+  return this->left != nullptr;
+}
+
+/**
+ * @brief Check if the node has a right child
+ * @return true if the right child is not nullptr
+ */
+template <class T> bool Node<T>::hasRight(void) const noexcept {
+  return this->right != nullptr;
+}
+
 /* >=====> Friend Section <=====< */
 
 /**
@@ -0,0 +1,81 @@
+/* >=====> MPMC Queue Benchmark <=====< */
+//=> 1 up to max (argv[1], default 64) producers and as many consumers pass a fixed number of timestamped
+//=> messages through a DSA::mpmc_queue<message, 1024>, with try_push/try_pop (yield and retry) and with
+//=> the blocking push/pop (futex sleep): throughput, and the time from push to pop at the 50th, 99th
+//=> and 99.9th percentiles.
+//=> Build with: cmake -S . -B build -DCMAKE_BUILD_TYPE=Release -DBUILD_BENCHMARKS=ON
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <fmt/core.h>
+#include <mpmc_queue.hpp>
+
+struct message {
+  std::uint64_t stamp; //=> nanoseconds on the steady clock when pushed
+  std::uint64_t payload;
+};
+constexpr size_t CAPACITY = 1024;
+constexpr size_t MESSAGES = 1 << 20; //=> split between the producers (and the consumers)
+using queue = DSA::mpmc_queue<message, CAPACITY>;
+
+std::uint64_t now(){ return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count(); }
+
+std::uint64_t percentile(std::vector<std::uint64_t>& latencies, double p){
+  auto nth = latencies.begin() + size_t(p * double(latencies.size() - 1));
+  std::nth_element(latencies.begin(), nth, latencies.end());
+  return *nth;
+}
+
+template<bool Blocking>
+void run(queue& q, size_t threads, std::uint64_t& checksum){
+  std::vector<std::vector<std::uint64_t>> latencies(threads);
+  std::vector<std::uint64_t> sums(threads);
+  std::vector<std::thread> workers;
+  auto start = std::chrono::steady_clock::now();
+  for(size_t t = 0; t < threads; t++){
+    workers.emplace_back([&q, t, threads]{ //=> producer
+      for(size_t i = 0; i < MESSAGES / threads; i++){
+        message m{now(), t * MESSAGES + i};
+        if constexpr (Blocking){ q.push(m); }
+        else { while(!q.try_push(m)){ std::this_thread::yield(); } }
+      }
+    });
+    workers.emplace_back([&q, &latencies, &sums, t, threads]{ //=> consumer
+      std::vector<std::uint64_t>& mine = latencies[t];
+      mine.reserve(MESSAGES / threads);
+      message m;
+      for(size_t i = 0; i < MESSAGES / threads; i++){
+        if constexpr (Blocking){ q.pop(m); }
+        else { while(!q.try_pop(m)){ std::this_thread::yield(); } }
+        mine.push_back(now() - m.stamp);
+        sums[t] += m.payload;
+      }
+    });
+  }
+  for(std::thread& worker : workers){ worker.join(); }
+  auto stop = std::chrono::steady_clock::now();
+
+  std::vector<std::uint64_t> all;
+  all.reserve(MESSAGES);
+  for(size_t t = 0; t < threads; t++){ all.insert(all.end(), latencies[t].begin(), latencies[t].end()); checksum += sums[t]; }
+  double throughput = double(all.size()) / std::chrono::duration<double, std::micro>(stop - start).count();
+  fmt::print("{:>8} | {:>9} | {:>10.2f} M/s | {:>10} ns | {:>10} ns | {:>10} ns   (checksum {})\n", threads, Blocking ? "blocking" : "try/yield",
+             throughput, percentile(all, 0.5), percentile(all, 0.99), percentile(all, 0.999), checksum);
+}
+
+int main(int argc, char** argv){
+  size_t max_threads = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 64;
+  auto q = std::make_unique<queue>(); //=> one cache line per cell: on the heap
+
+  std::uint64_t checksum = 0;
+  fmt::print("{:>8} | {:>9} | {:>14} | {:>13} | {:>13} | {:>13}\n", "threads", "mode", "throughput", "p50", "p99", "p99.9");
+  for(size_t threads = 1; threads <= max_threads; threads *= 2){
+    run<false>(*q, threads, checksum);
+    run<true>(*q, threads, checksum);
+  }
+  return 0;
+}
@@ -0,0 +1,91 @@
+/* >=====> SPSC Ring Benchmark <=====< */
+//=> 2^max (argv[1], default 26) integers moved from a producer thread to a consumer thread through a
+//=> DSA::spsc_ring<std::uint64_t, 4096>, one at a time and in batches of 256, next to a std::deque
+//=> behind a std::mutex. Pin the two threads to two cores (taskset -c 0,2) for stable numbers; a side
+//=> that finds the ring full (or empty) yields, so it also runs on a single core.
+//=> Build with: cmake -S . -B build -DCMAKE_BUILD_TYPE=Release -DBUILD_BENCHMARKS=ON
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <fmt/core.h>
+#include <spsc_ring.hpp>
+
+using element = std::uint64_t;
+constexpr size_t CAPACITY = 4096;
+constexpr size_t BATCH = 256;
+
+struct locked_queue { //=> the baseline: one lock around the standard deque, capped at CAPACITY
+  std::deque<element> queue;
+  std::mutex lock;
+  bool try_push(element value){ std::lock_guard guard(lock); if(queue.size() == CAPACITY){ return false; } queue.push_back(value); return true; }
+  bool try_pop(element& out){ std::lock_guard guard(lock); if(queue.empty()){ return false; } out = queue.front(); queue.pop_front(); return true; }
+};
+
+template<class Producer, class Consumer>
+double run(size_t n, Producer produce, Consumer consume, element& checksum){ //=> million items per second
+  auto start = std::chrono::steady_clock::now();
+  std::thread producer(produce);
+  checksum += consume();
+  producer.join();
+  auto stop = std::chrono::steady_clock::now();
+  return n / std::chrono::duration<double, std::micro>(stop - start).count();
+}
+
+template<class Queue>
+double one_at_a_time(Queue& queue, size_t n, element& checksum){
+  return run(n, [&queue, n]{
+    for(element i = 0; i < n; ){ if(queue.try_push(i)){ i++; } else { std::this_thread::yield(); } }
+  }, [&queue, n]{
+    element total = 0, value;
+    for(size_t i = 0; i < n; ){ if(queue.try_pop(value)){ total += value; i++; } else { std::this_thread::yield(); } }
+    return total;
+  }, checksum);
+}
+
+double batched(DSA::spsc_ring<element, CAPACITY>& ring, size_t n, element& checksum){
+  return run(n, [&ring, n]{
+    std::vector<element> batch(BATCH);
+    for(element i = 0; i < n; ){
+      size_t count = std::min(BATCH, n - i);
+      for(size_t k = 0; k < count; k++){ batch[k] = i + k; }
+      for(size_t sent = 0; sent < count; ){
+        size_t pushed = ring.push_batch(std::span<const element>(batch.data() + sent, count - sent));
+        if(pushed == 0){ std::this_thread::yield(); }
+        sent += pushed;
+      }
+      i += count;
+    }
+  }, [&ring, n]{
+    std::vector<element> batch(BATCH);
+    element total = 0;
+    for(size_t i = 0; i < n; ){
+      size_t popped = ring.pop_batch(batch);
+      if(popped == 0){ std::this_thread::yield(); }
+      for(size_t k = 0; k < popped; k++){ total += batch[k]; }
+      i += popped;
+    }
+    return total;
+  }, checksum);
+}
+
+int main(int argc, char** argv){
+  size_t n = size_t(1) << ((argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 26);
+  auto ring = std::make_unique<DSA::spsc_ring<element, CAPACITY>>(); //=> 32 KB of slots: on the heap
+  locked_queue locked;
+
+  element checksum = 0;
+  double single = one_at_a_time(*ring, n, checksum);
+  double batch = batched(*ring, n, checksum);
+  double baseline = one_at_a_time(locked, n, checksum);
+  fmt::print("{:>24} | {:>14}\n", "queue", "throughput");
+  fmt::print("{:>24} | {:>8.1f} M/s\n", "spsc_ring", single);
+  fmt::print("{:>24} | {:>8.1f} M/s\n", "spsc_ring, batches", batch);
+  fmt::print("{:>24} | {:>8.1f} M/s   (checksum {})\n", "deque + mutex", baseline, checksum);
+  return 0;
+}
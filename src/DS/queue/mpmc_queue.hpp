@@ -0,0 +1,122 @@
+#ifndef MPMC_QUEUE_HPP
+#define MPMC_QUEUE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <DS/array/array.hpp> //=> for DSA::array, the cells
+
+namespace DSA{
+    /* >=====> Multi-Producer Multi-Consumer Queue <=====< */
+    //=> A bounded queue for any number of producer and consumer threads (D. Vyukov's design): Capacity cells
+    //=> (a power of two) in a DSA::array, each with a sequence number that says whose turn it is. Position
+    //=> pos may be written when its cell reads pos and read when it reads pos + 1; the reader then sets it to
+    //=> pos + Capacity, the writer's turn one lap later. A thread only touches the shared positions to claim
+    //=> a cell, and every cell has its own cache line, so neighbouring threads do not invalidate each other.
+    //=> try_push/try_pop claim a cell with a compare-exchange and give up when the queue is full (empty).
+    //=> push/pop take a ticket with fetch_add and sleep on their cell's sequence with std::atomic::wait
+    //=> (a futex on Linux, after a short spin) until their turn comes; every release wakes the sleepers.
+    //=> Sequences are 32 bits, the width of a futex word, and compared as signed differences, so they wrap.
+    //=> Blocked consumers are woken by pushes only: to shut a pool down, push one stop value per consumer.
+    template<class T, size_t Capacity>
+    class mpmc_queue {
+        static_assert(Capacity > 1 && (Capacity & (Capacity - 1)) == 0 && Capacity <= (size_t(1) << 30), "Error: Capacity must be a power of two, 2 to 2^30!");
+        static_assert(std::is_default_constructible_v<T> && std::is_move_assignable_v<T>, "Error: Cells need a default constructible, move assignable T!");
+        public:
+            static constexpr size_t LINE = 64; //a cache line
+        private:
+            using turn = std::uint32_t;
+            static constexpr turn MASK = turn(Capacity - 1);
+
+            struct alignas(LINE) cell {
+                std::atomic<turn> sequence{0};
+                T value{};
+            };
+
+            alignas(LINE) std::atomic<turn> tail{0}; //next position to push
+            alignas(LINE) std::atomic<turn> head{0}; //next position to pop
+            alignas(LINE) array<cell, Capacity, LINE> cells;
+
+            static std::int32_t distance(turn sequence, turn position) noexcept { return std::int32_t(sequence - position); } //wrap-safe comparison
+
+            static void await(std::atomic<turn>& sequence, turn expected) noexcept { //sleeps until sequence == expected
+                for(turn seen = sequence.load(std::memory_order_acquire); seen != expected; seen = sequence.load(std::memory_order_acquire)){
+                    sequence.wait(seen, std::memory_order_acquire);
+                }
+            }
+            static void release(std::atomic<turn>& sequence, turn next) noexcept {
+                sequence.store(next, std::memory_order_release);
+                sequence.notify_all(); //a producer and a consumer, possibly from different laps, may sleep on the same cell
+            }
+
+        public:
+            /*assigning*/
+            mpmc_queue() noexcept { for(turn i = 0; i < turn(Capacity); i++){ this->cells[i].sequence.store(i, std::memory_order_relaxed); } } //declaration (empty)
+            mpmc_queue(const mpmc_queue&) = delete; //the threads hold references to it
+            mpmc_queue& operator=(const mpmc_queue&) = delete;
+            ~mpmc_queue() = default; //destructor
+
+            //non-blocking || O(1), lock-free
+            template<class U>
+            bool try_push(U&& value){ //false if the queue is full
+                turn position = this->tail.load(std::memory_order_relaxed);
+                cell* target;
+                for(;;){
+                    target = &this->cells[position & MASK];
+                    std::int32_t lag = distance(target->sequence.load(std::memory_order_acquire), position);
+                    if(lag == 0){ //the cell is free: claim it
+                        if(this->tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)){ break; }
+                    }
+                    else if(lag < 0){ return false; } //still holds the value of the previous lap
+                    else { position = this->tail.load(std::memory_order_relaxed); } //another producer got there first
+                }
+                target->value = std::forward<U>(value);
+                release(target->sequence, position + 1);
+                return true;
+            }
+            bool try_pop(T& out){ //false if the queue is empty
+                turn position = this->head.load(std::memory_order_relaxed);
+                cell* target;
+                for(;;){
+                    target = &this->cells[position & MASK];
+                    std::int32_t lag = distance(target->sequence.load(std::memory_order_acquire), position + 1);
+                    if(lag == 0){ //the cell is filled: claim it
+                        if(this->head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)){ break; }
+                    }
+                    else if(lag < 0){ return false; } //not written yet
+                    else { position = this->head.load(std::memory_order_relaxed); } //another consumer got there first
+                }
+                out = std::move(target->value);
+                release(target->sequence, position + turn(Capacity));
+                return true;
+            }
+
+            //blocking || O(1) plus the wait for a free (filled) cell
+            template<class U>
+            void push(U&& value){
+                turn position = this->tail.fetch_add(1, std::memory_order_relaxed); //a ticket: this cell, this lap
+                cell& target = this->cells[position & MASK];
+                await(target.sequence, position);
+                target.value = std::forward<U>(value);
+                release(target.sequence, position + 1);
+            }
+            void pop(T& out){
+                turn position = this->head.fetch_add(1, std::memory_order_relaxed);
+                cell& target = this->cells[position & MASK];
+                await(target.sequence, position + 1);
+                out = std::move(target.value);
+                release(target.sequence, position + turn(Capacity));
+            }
+
+            //size and capacity (snapshots while threads run)
+            static constexpr size_t capacity(void) noexcept { return Capacity; }
+            size_t size(void) const noexcept { //claimed pushes minus claimed pops, within 0..Capacity
+                turn h = this->head.load(std::memory_order_acquire);
+                std::int32_t count = distance(this->tail.load(std::memory_order_acquire), h);
+                return count < 0 ? 0 : (size_t(count) > Capacity ? Capacity : size_t(count));
+            }
+            bool empty(void) const noexcept { return this->size() == 0; }
+    };
+}
+#endif
@@ -0,0 +1,106 @@
+#ifndef SPSC_RING_HPP
+#define SPSC_RING_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <DS/array/array.hpp> //=> for DSA::array, the slots
+
+namespace DSA{
+    /* >=====> Single-Producer Single-Consumer Ring <=====< */
+    //=> A bounded lock-free queue between exactly one producer thread and one consumer thread, stored in a
+    //=> DSA::array of Capacity slots (a power of two: an index is a mask away from its slot). head and tail
+    //=> only ever grow, so full is tail - head == Capacity and no slot is wasted.
+    //=> The producer writes only tail and the consumer only head, each on its own cache line; each side also
+    //=> keeps a private copy of the other's index and rereads the shared one only when its copy says the ring
+    //=> is full (or empty). In steady state a push or pop touches one shared line, not two.
+    //=> push_batch/pop_batch move a whole span with one index update: at most two copies (the ring wraps).
+    //=> The slots are assigned, not constructed, so T must be default constructible and move assignable.
+    template<class T, size_t Capacity>
+    class spsc_ring {
+        static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Error: Capacity must be a power of two!");
+        static_assert(std::is_default_constructible_v<T> && std::is_move_assignable_v<T>, "Error: Slots need a default constructible, move assignable T!");
+        public:
+            static constexpr size_t LINE = 64; //a cache line
+        private:
+            static constexpr size_t MASK = Capacity - 1;
+
+            alignas(LINE) std::atomic<size_t> head{0}; //next slot to pop, written by the consumer
+            size_t cached_tail = 0; //the consumer's copy of tail
+            alignas(LINE) std::atomic<size_t> tail{0}; //next slot to push, written by the producer
+            size_t cached_head = 0; //the producer's copy of head
+            alignas(LINE) array<T, Capacity, LINE> slots;
+
+        public:
+            /*assigning*/
+            spsc_ring() = default; //declaration (empty)
+            spsc_ring(const spsc_ring&) = delete; //the threads hold references to it
+            spsc_ring& operator=(const spsc_ring&) = delete;
+            ~spsc_ring() = default; //destructor
+
+            //producer || O(1)
+            template<class U>
+            bool try_push(U&& value){ //false if the ring is full
+                size_t t = this->tail.load(std::memory_order_relaxed);
+                if(t - this->cached_head == Capacity){
+                    this->cached_head = this->head.load(std::memory_order_acquire);
+                    if(t - this->cached_head == Capacity){ return false; }
+                }
+                this->slots[t & MASK] = std::forward<U>(value);
+                this->tail.store(t + 1, std::memory_order_release); //publishes the slot
+                return true;
+            }
+            size_t push_batch(std::span<const T> values){ //O(n), pushes as many as fit and returns how many
+                size_t t = this->tail.load(std::memory_order_relaxed);
+                size_t room = Capacity - (t - this->cached_head);
+                if(room < values.size()){
+                    this->cached_head = this->head.load(std::memory_order_acquire);
+                    room = Capacity - (t - this->cached_head);
+                }
+                size_t n = std::min(room, values.size());
+                size_t first = std::min(n, Capacity - (t & MASK)); //up to the end of the array, the rest wraps
+                std::copy(values.data(), values.data() + first, this->slots.data() + (t & MASK));
+                std::copy(values.data() + first, values.data() + n, this->slots.data());
+                this->tail.store(t + n, std::memory_order_release);
+                return n;
+            }
+
+            //consumer || O(1)
+            bool try_pop(T& out){ //false if the ring is empty
+                size_t h = this->head.load(std::memory_order_relaxed);
+                if(h == this->cached_tail){
+                    this->cached_tail = this->tail.load(std::memory_order_acquire);
+                    if(h == this->cached_tail){ return false; }
+                }
+                out = std::move(this->slots[h & MASK]);
+                this->head.store(h + 1, std::memory_order_release); //hands the slot back
+                return true;
+            }
+            size_t pop_batch(std::span<T> out){ //O(n), pops up to out.size() values and returns how many
+                size_t h = this->head.load(std::memory_order_relaxed);
+                size_t ready = this->cached_tail - h;
+                if(ready < out.size()){
+                    this->cached_tail = this->tail.load(std::memory_order_acquire);
+                    ready = this->cached_tail - h;
+                }
+                size_t n = std::min(ready, out.size());
+                size_t first = std::min(n, Capacity - (h & MASK));
+                std::move(this->slots.data() + (h & MASK), this->slots.data() + (h & MASK) + first, out.data());
+                std::move(this->slots.data(), this->slots.data() + (n - first), out.data() + first);
+                this->head.store(h + n, std::memory_order_release);
+                return n;
+            }
+
+            //size and capacity (from a third thread these are only snapshots)
+            static constexpr size_t capacity(void) noexcept { return Capacity; }
+            size_t size(void) const noexcept {
+                size_t h = this->head.load(std::memory_order_acquire);
+                return this->tail.load(std::memory_order_acquire) - h;
+            }
+            bool empty(void) const noexcept { return this->size() == 0; }
+            bool full(void) const noexcept { return this->size() == Capacity; }
+    };
+}
+#endif
@@ -0,0 +1,51 @@
+/* >=====> Small Vector Benchmark <=====< */
+//=> 2^max (argv[1], default 22) simulated requests, each filling a fresh vector with its own element
+//=> count: 90% of them below 16, the rest up to 64. std::vector next to DSA::vector and
+//=> DSA::small_vector<16>, the DSA ones on a counting_allocator to show the heap calls left per request.
+//=> Build with: cmake -S . -B build -DCMAKE_BUILD_TYPE=Release -DBUILD_BENCHMARKS=ON
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include <fmt/core.h>
+#include <vector.hpp>
+#include <small_vector.hpp>
+
+using element = std::uint64_t;
+template<class Tag>
+struct tagged : DSA::malloc_allocator {}; //=> one set of counters per container
+using counted_vector = DSA::counting_allocator<tagged<struct vector_tag>>;
+using counted_small = DSA::counting_allocator<tagged<struct small_tag>>;
+
+template<class Vector>
+double run(const std::vector<std::uint8_t>& sizes, std::uint64_t& checksum){ //=> nanoseconds per request
+  auto start = std::chrono::steady_clock::now();
+  for(std::uint8_t size : sizes){
+    Vector values;
+    for(element i = 0; i < size; i++){ values.push_back(i * size); }
+    element total = 0;
+    for(element value : values){ total += value; }
+    checksum += total;
+  }
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(stop - start).count() / double(sizes.size());
+}
+
+int main(int argc, char** argv){
+  size_t requests = size_t(1) << ((argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 22);
+  std::mt19937_64 random(42);
+  std::vector<std::uint8_t> sizes(requests);
+  for(std::uint8_t& size : sizes){ size = std::uint8_t(random() % 10 ? random() % 16 : 16 + random() % 49); }
+
+  std::uint64_t checksum = 0;
+  double standard = run<std::vector<element>>(sizes, checksum);
+  double growable = run<DSA::vector<element, counted_vector>>(sizes, checksum);
+  double small = run<DSA::small_vector<element, 16, counted_small>>(sizes, checksum);
+
+  fmt::print("{:>30} | {:>12} | {:>16}\n", "container", "per request", "allocations");
+  fmt::print("{:>30} | {:>9.1f} ns | {:>16}\n", "std::vector", standard, "-");
+  fmt::print("{:>30} | {:>9.1f} ns | {:>16.3f}\n", "DSA::vector", growable, double(counted_vector::counters.allocations + counted_vector::counters.reallocations) / double(requests));
+  fmt::print("{:>30} | {:>9.1f} ns | {:>16.3f}   (checksum {})\n", "DSA::small_vector<16>", small, double(counted_small::counters.allocations + counted_small::counters.reallocations) / double(requests), checksum);
+  return 0;
+}
@@ -0,0 +1,88 @@
+/* >=====> Structure of Arrays Benchmark <=====< */
+//=> 2^max (argv[1], default 22) records of 10 fields (80 bytes), stored as an array of structs
+//=> (DSA::vector<record>) and as a DSA::soa_vector. Each pass reads 2 fields of every record:
+//=> the sum of price over the rows with quantity above a threshold, plus a one-column sum.
+//=> Then both are sorted by one field with heap::heap_sort (sort_by<I> for the soa_vector).
+//=> Build with: cmake -S . -B build -DCMAKE_BUILD_TYPE=Release -DBUILD_BENCHMARKS=ON
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <fmt/core.h>
+#include <vector.hpp>
+#include <soa_vector.hpp>
+#include <heap.hpp>
+
+constexpr size_t PASSES = 16;
+
+struct record {
+  std::uint64_t id;
+  double price;
+  std::uint32_t quantity, region;
+  std::uint64_t customer, product;
+  double discount, tax, weight, volume;
+  std::uint64_t timestamp;
+  friend bool operator>(const record& left, const record& right){ return left.price > right.price; } //=> for heap::heap_sort
+};
+using records = DSA::soa_vector<std::uint64_t, double, std::uint32_t, std::uint32_t, std::uint64_t, std::uint64_t, double, double, double, double, std::uint64_t>;
+enum { ID, PRICE, QUANTITY }; //=> columns of records
+
+template<class Pass>
+double time_passes(Pass pass, double& checksum){ //=> nanoseconds per record
+  size_t n = 0;
+  auto start = std::chrono::steady_clock::now();
+  for(size_t p = 0; p < PASSES; p++){ n += pass(checksum); }
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(stop - start).count() / double(n);
+}
+
+int main(int argc, char** argv){
+  size_t n = size_t(1) << ((argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 22);
+  std::mt19937_64 random(42);
+  DSA::vector<record> aos;
+  records soa;
+  aos.reserve_exact(n);
+  soa.reserve(n);
+  for(size_t i = 0; i < n; i++){
+    record r{i, double(random() % 100000) / 100, std::uint32_t(random() % 100), std::uint32_t(random() % 16), random(), random(), 0.1, 0.2, 1.0, 2.0, random()};
+    aos.push_back_unchecked(r);
+    soa.push_back(r.id, r.price, r.quantity, r.region, r.customer, r.product, r.discount, r.tax, r.weight, r.volume, r.timestamp);
+  }
+
+  double checksum = 0;
+  double aos_filter = time_passes([&aos](double& checksum){
+    double total = 0;
+    for(const record& r : aos){ total += r.quantity > 50 ? r.price : 0.0; }
+    checksum += total;
+    return aos.size();
+  }, checksum);
+  double soa_filter = time_passes([&soa](double& checksum){
+    auto quantity = soa.column<QUANTITY>();
+    auto price = soa.column<PRICE>();
+    double total = 0;
+    for(size_t r = 0; r < soa.size(); r++){ total += quantity[r] > 50 ? price[r] : 0.0; }
+    checksum += total;
+    return soa.size();
+  }, checksum);
+  double aos_sum = time_passes([&aos](double& checksum){
+    double total = 0;
+    for(const record& r : aos){ total += r.price; }
+    checksum += total;
+    return aos.size();
+  }, checksum);
+  double soa_sum = time_passes([&soa](double& checksum){ checksum += soa.sum<PRICE>(); return soa.size(); }, checksum);
+
+  auto start = std::chrono::steady_clock::now();
+  heap::heap_sort(aos.data(), aos.size());
+  auto middle = std::chrono::steady_clock::now();
+  soa.sort_by<PRICE>();
+  auto stop = std::chrono::steady_clock::now();
+  checksum += aos[n / 2].price + std::get<PRICE>(soa[n / 2]);
+
+  fmt::print("{:>28} | {:>16} | {:>16}\n", "pass", "array of structs", "soa_vector");
+  fmt::print("{:>28} | {:>13.2f} ns | {:>13.2f} ns\n", "price where quantity > 50", aos_filter, soa_filter);
+  fmt::print("{:>28} | {:>13.2f} ns | {:>13.2f} ns\n", "sum of price", aos_sum, soa_sum);
+  fmt::print("{:>28} | {:>14.3f} s | {:>14.3f} s   (checksum {:.0f})\n", "heap sort by price",
+             std::chrono::duration<double>(middle - start).count(), std::chrono::duration<double>(stop - middle).count(), checksum);
+  return 0;
+}
@@ -0,0 +1,54 @@
+/* >=====> Vector Ingestion Benchmark <=====< */
+//=> push_back of 2^max (argv[1], default 30: about 1B) 32-bit elements into an empty vector, one
+//=> container at a time: std::vector, DSA::vector with realloc (malloc_allocator) and with mremap
+//=> (mmap_allocator), both growth factors, and the reserved variants (reserve + push_back next to
+//=> reserve_exact + push_back_unchecked). 2^30 elements need 4 GiB (up to 10 GiB while std::vector copies).
+//=> Build with: cmake -S . -B build -DCMAKE_BUILD_TYPE=Release -DBUILD_BENCHMARKS=ON
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+#include <fmt/core.h>
+#include <vector.hpp>
+
+using element = std::uint32_t;
+
+template<class Fill>
+void run(const char* name, size_t n, Fill fill){
+  auto start = std::chrono::steady_clock::now();
+  std::uint64_t checksum = fill(n);
+  auto stop = std::chrono::steady_clock::now();
+  double seconds = std::chrono::duration<double>(stop - start).count();
+  fmt::print("{:>48} | {:>8.3f} s | {:>8.1f} M/s   (checksum {})\n", name, seconds, double(n) / seconds / 1e6, checksum);
+}
+
+template<class Vector>
+std::uint64_t grow(size_t n){ //=> push_back from empty, the growth policy decides every reallocation
+  Vector values;
+  for(size_t i = 0; i < n; i++){ values.push_back(element(i * 2654435761u)); }
+  return values.size() + values[n / 3] + values.back();
+}
+
+int main(int argc, char** argv){
+  size_t n = size_t(1) << ((argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 30);
+
+  fmt::print("{:>48} | {:>10} | {:>10}\n", "container", "time", "rate");
+  run("std::vector push_back", n, grow<std::vector<element>>);
+  run("DSA::vector<malloc, 3/2> push_back", n, grow<DSA::vector<element>>);
+  run("DSA::vector<malloc, 2> push_back", n, grow<DSA::vector<element, DSA::malloc_allocator, DSA::doubling>>);
+  run("DSA::vector<mmap, 3/2> push_back", n, grow<DSA::vector<element, DSA::mmap_allocator>>);
+  run("DSA::vector<mmap, 2> push_back", n, grow<DSA::vector<element, DSA::mmap_allocator, DSA::doubling>>);
+  run("std::vector reserve + push_back", n, [](size_t n){
+    std::vector<element> values;
+    values.reserve(n);
+    for(size_t i = 0; i < n; i++){ values.push_back(element(i * 2654435761u)); }
+    return std::uint64_t(values.size() + values[n / 3] + values.back());
+  });
+  run("DSA::vector reserve_exact + push_back_unchecked", n, [](size_t n){
+    DSA::vector<element> values;
+    values.reserve_exact(n);
+    for(size_t i = 0; i < n; i++){ values.push_back_unchecked(element(i * 2654435761u)); }
+    return std::uint64_t(values.size() + values[n / 3] + values.back());
+  });
+  return 0;
+}
@@ -0,0 +1,132 @@
+#ifndef SMALL_VECTOR_HPP
+#define SMALL_VECTOR_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <DS/array/array.hpp> //=> for DSA::array, the inline storage
+#include "vector.hpp" //=> for vector_base, the allocators and growth policies
+
+namespace DSA{
+    /* >=====> Small Vector <=====< */
+    //=> A DSA::vector that keeps its first N elements in a DSA::array inside the object and only goes to
+    //=> Alloc once it holds more. Most short-lived vectors (a few elements per request) then never allocate.
+    //=> Moving a spilled vector steals its heap block in O(1); moving an inline one moves at most N
+    //=> elements (one memcpy for trivially relocatable ones). shrink_to_fit brings it back inline when it fits.
+    //=> Use counting_allocator<> as Alloc to check how often the heap is still hit.
+    template<class T, size_t N, class Alloc = malloc_allocator, class Growth = growth_factor<>>
+    class small_vector : public vector_base<small_vector<T, N, Alloc, Growth>, T> {
+        static_assert(N > 0, "Error: Inline capacity must be at least 1!");
+        private:
+            friend vector_base<small_vector, T>; //calls grow
+            union { array<T, N> buffer; }; //inline storage, constructed element by element; elements points here or to a heap block
+            static constexpr bool RELOCATABLE = is_trivially_relocatable_v<T>;
+
+            T* local(void) noexcept { return this->buffer.data(); }
+            static void relocate(T* from, size_t n, T* to){ //move n elements to uninitialized memory, ending their lives at from
+                if constexpr (RELOCATABLE){ if(n){ std::memcpy(static_cast<void*>(to), static_cast<const void*>(from), n * sizeof(T)); } }
+                else {
+                    if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>){ std::uninitialized_move_n(from, n, to); }
+                    else { std::uninitialized_copy_n(from, n, to); } //copies if the move may throw, so that a failure leaves from as it was
+                    std::destroy_n(from, n);
+                }
+            }
+            void reallocate(size_t capacity){ //capacity >= count and > N
+                if(RELOCATABLE && !this->is_inline()){
+                    this->elements = static_cast<T*>(Alloc::reallocate(this->elements, this->space * sizeof(T), capacity * sizeof(T), alignof(T)));
+                }
+                else {
+                    T* moved = static_cast<T*>(Alloc::allocate(capacity * sizeof(T), alignof(T)));
+                    try { relocate(this->elements, this->count, moved); }
+                    catch(...) { Alloc::deallocate(moved, capacity * sizeof(T)); throw; }
+                    if(!this->is_inline()){ Alloc::deallocate(this->elements, this->space * sizeof(T)); }
+                    this->elements = moved;
+                }
+                this->space = capacity;
+            }
+            void grow(size_t required){ //at least required, by the growth factor
+                if(required > this->max_size()){ throw std::length_error("Error: Size is exceeded!"); }
+                this->reallocate(std::min(Growth::next(this->space, required), this->max_size()));
+            }
+            void release(void) noexcept { //back to an empty inline vector
+                std::destroy_n(this->elements, this->count);
+                if(!this->is_inline()){ Alloc::deallocate(this->elements, this->space * sizeof(T)); }
+                this->elements = this->local();
+                this->count = 0;
+                this->space = N;
+            }
+            void take(small_vector& other) noexcept(std::is_nothrow_move_constructible_v<T>) { //requires *this empty and inline
+                if(other.is_inline()){ relocate(other.elements, other.count, this->elements); } //at most N elements
+                else { //steal the block
+                    this->elements = other.elements;
+                    this->space = other.space;
+                    other.elements = other.local();
+                    other.space = N;
+                }
+                this->count = other.count;
+                other.count = 0;
+            }
+
+        public:
+            /*assigning*/
+            small_vector() noexcept { this->elements = this->local(); this->space = N; } //declaration, empty and inline
+            explicit small_vector(size_t size) : small_vector() { this->resize(size); } //size value-initialized elements
+            small_vector(size_t size, const T& value) : small_vector() { this->resize(size, value); } //size copies of value
+            small_vector(std::initializer_list<T> list) : small_vector() { this->append(list.begin(), list.size()); } //assigning with a list
+            small_vector(const small_vector& other) : small_vector() { this->append(other.elements, other.count); } //copying (delegating: a throw frees what was built)
+            small_vector(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) : small_vector() { this->take(other); } //moving
+
+            small_vector& operator=(const small_vector& other){ //assigning with an other object (Copy constructure)
+                if(this != &other){
+                    this->clear();
+                    this->append(other.elements, other.count);
+                }
+                return *this;
+            }
+            small_vector& operator=(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+                if(this != &other){
+                    this->release();
+                    this->take(other);
+                }
+                return *this;
+            }
+            small_vector& operator=(std::initializer_list<T> list){ this->clear(); this->append(list.begin(), list.size()); return *this; }
+            ~small_vector(){ this->release(); } //destructor
+
+            //size and capacity
+            static constexpr size_t inline_capacity(void) noexcept { return N; }
+            bool is_inline(void) const noexcept { return this->elements == this->buffer.data(); } //no heap block
+
+            void shrink_to_fit(void){ //back inline when size <= N, else capacity == size
+                if(this->is_inline() || this->count == this->space){ return; }
+                if(this->count <= N){
+                    T* block = this->elements;
+                    relocate(block, this->count, this->local());
+                    Alloc::deallocate(block, this->space * sizeof(T));
+                    this->elements = this->local();
+                    this->space = N;
+                    return;
+                }
+                this->reallocate(this->count);
+            }
+
+            //operations
+            void swap(small_vector& other) noexcept(std::is_nothrow_move_constructible_v<T>) { //O(1) when both are on the heap
+                if(!this->is_inline() && !other.is_inline()){
+                    std::swap(this->elements, other.elements);
+                    std::swap(this->count, other.count);
+                    std::swap(this->space, other.space);
+                    return;
+                }
+                small_vector held(std::move(other));
+                other = std::move(*this);
+                *this = std::move(held);
+            }
+    };
+}
+#endif
@@ -0,0 +1,198 @@
+#ifndef SOA_VECTOR_HPP
+#define SOA_VECTOR_HPP
+
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "vector.hpp" //=> for DSA::vector, one per column
+#include <Algorithms/Heap/heap.hpp> //=> for heap::heap_sort
+#include <Algorithms/Divide_and_Conquer/Search/Binary/binary.hpp> //=> for binary::lower_bound
+
+namespace DSA{
+    /* >=====> Structure of Arrays <=====< */
+    //=> Rows of (Fields...) stored column by column: field I of every row sits in its own 64-byte aligned
+    //=> DSA::vector. A pass that reads 2 of 10 fields loads only those 2 columns, and a column scan is a plain
+    //=> loop over contiguous memory that the compiler turns into aligned SIMD loads.
+    //=> v[i] is a row proxy, a std::tuple of references (structured bindings, std::get, assignment from a
+    //=> tuple of values); column<I>() is a std::span over one field.
+    //=> sort_by<I>() sorts the rows by column I with heap::heap_sort, lower_bound<I>() and find<I>() then
+    //=> search that column with binary::lower_bound.
+    template<class... Fields>
+    class soa_vector {
+        static_assert(sizeof...(Fields) > 0, "Error: A record needs at least one field!");
+        public:
+            static constexpr size_t ALIGNMENT = 64; //a cache line, two AVX2 registers
+            template<size_t I>
+            using field = std::tuple_element_t<I, std::tuple<Fields...>>;
+            using reference = std::tuple<Fields&...>;
+            using const_reference = std::tuple<const Fields&...>;
+            using value_type = std::tuple<Fields...>;
+
+        private:
+            template<class F>
+            using column_type = vector<F, aligned_allocator<ALIGNMENT>>;
+            std::tuple<column_type<Fields>...> columns;
+            size_t count = 0;
+
+            template<class K>
+            struct sort_key { //the column value and its row: the row breaks ties, which makes the heap sort stable
+                K key;
+                size_t row;
+                friend bool operator>(const sort_key& left, const sort_key& right){
+                    return right.key < left.key || (!(left.key < right.key) && left.row > right.row);
+                }
+            };
+
+            template<class Function, size_t... I>
+            void for_each_column(Function&& function, std::index_sequence<I...>){ (function(std::get<I>(this->columns)), ...); }
+            template<class Function>
+            void for_each_column(Function&& function){ this->for_each_column(std::forward<Function>(function), std::index_sequence_for<Fields...>{}); }
+            template<class Function, size_t... I>
+            void for_each_column(Function&& function, std::index_sequence<I...>) const { (function(std::get<I>(this->columns)), ...); }
+            template<class Function>
+            void for_each_column(Function&& function) const { this->for_each_column(std::forward<Function>(function), std::index_sequence_for<Fields...>{}); }
+
+            template<size_t... I>
+            reference row(size_t index, std::index_sequence<I...>) noexcept { return reference(std::get<I>(this->columns)[index]...); }
+            template<size_t... I>
+            const_reference row(size_t index, std::index_sequence<I...>) const noexcept { return const_reference(std::get<I>(this->columns)[index]...); }
+
+            template<class Row>
+            class row_iterator { //yields row proxies by value
+                private:
+                    Row* rows;
+                    size_t index;
+                public:
+                    using difference_type = std::ptrdiff_t;
+                    using value_type = typename std::remove_const_t<Row>::value_type;
+                    row_iterator(Row* rows = nullptr, size_t index = 0) noexcept : rows(rows), index(index) {}
+                    auto operator*() const noexcept { return (*rows)[index]; }
+                    row_iterator& operator++() noexcept { ++index; return *this; }
+                    row_iterator operator++(int) noexcept { return row_iterator(rows, index++); }
+                    friend bool operator==(const row_iterator& left, const row_iterator& right) noexcept { return left.index == right.index; }
+            };
+
+        public:
+            using iterator = row_iterator<soa_vector>;
+            using const_iterator = row_iterator<const soa_vector>;
+
+            /*assigning*/
+            soa_vector() = default; //declaration
+            soa_vector(const soa_vector& other) = default; //copying, column by column
+            soa_vector(soa_vector&& other) noexcept : columns(std::move(other.columns)), count(std::exchange(other.count, 0)) {} //moving, takes the columns
+            soa_vector& operator=(const soa_vector& other) = default;
+            soa_vector& operator=(soa_vector&& other) noexcept {
+                this->columns = std::move(other.columns);
+                this->count = std::exchange(other.count, 0);
+                return *this;
+            }
+
+            //accessing
+            reference operator[](size_t index) noexcept { return this->row(index, std::index_sequence_for<Fields...>{}); } //a row by []
+            const_reference operator[](size_t index) const noexcept { return this->row(index, std::index_sequence_for<Fields...>{}); } //a row by []
+
+            reference at(size_t index){ // a row by a function with an exception
+                if(index >= this->count){ throw std::out_of_range("Error: Index is out of range!"); }
+                return (*this)[index];
+            }
+            const_reference at(size_t index) const { // a row by a function with an exception
+                if(index >= this->count){ throw std::out_of_range("Error: Index is out of range!"); }
+                return (*this)[index];
+            }
+
+            template<size_t I>
+            std::span<field<I>> column(void) noexcept { return std::span<field<I>>(std::get<I>(this->columns).data(), this->count); } //one field of every row
+            template<size_t I>
+            std::span<const field<I>> column(void) const noexcept { return std::span<const field<I>>(std::get<I>(this->columns).data(), this->count); } //one field of every row
+
+            iterator begin(void) noexcept { return iterator(this, 0); } //rows, first to last
+            const_iterator begin(void) const noexcept { return const_iterator(this, 0); } //rows, first to last
+            iterator end(void) noexcept { return iterator(this, this->count); } //past the last row
+            const_iterator end(void) const noexcept { return const_iterator(this, this->count); } //past the last row
+
+            //size and capacity
+            size_t size(void) const noexcept { return this->count; }
+            size_t capacity(void) const noexcept { //rows that fit without a reallocation: the smallest column capacity
+                size_t rows = std::get<0>(this->columns).capacity();
+                this->for_each_column([&rows](const auto& column){ rows = column.capacity() < rows ? column.capacity() : rows; });
+                return rows;
+            }
+            bool empty(void) const noexcept { return this->count == 0; }
+
+            void reserve(size_t capacity){ this->for_each_column([capacity](auto& column){ column.reserve_exact(capacity); }); } //room for capacity rows in every column
+
+            //operations
+            void push_back(const Fields&... values){ this->push_back(std::forward_as_tuple(values...), std::index_sequence_for<Fields...>{}); } //amortized O(fields)
+            void push_back(const value_type& values){ this->push_back(values, std::index_sequence_for<Fields...>{}); } //a row as a tuple
+            void pop_back(void) noexcept { this->for_each_column([](auto& column){ column.pop_back(); }); --this->count; } //requires !empty()
+
+            void resize(size_t size){ //new rows are value-initialized; on a throw every column is cut back to size()
+                if(size > this->count){ this->reserve(size); }
+                try { this->for_each_column([size](auto& column){ column.resize(size); }); }
+                catch(...){ this->for_each_column([n = this->count](auto& column){ if(column.size() > n){ column.resize(n); } }); throw; }
+                this->count = size;
+            }
+            void clear(void) noexcept { this->for_each_column([](auto& column){ column.clear(); }); this->count = 0; } //keeps the capacity
+
+            template<size_t I>
+            void sort_by(void){ //O(n log n) sort of column I (ties keep their order), then one gather per column
+                column_type<sort_key<field<I>>> keys;
+                keys.reserve_exact(this->count);
+                const field<I>* values = std::get<I>(this->columns).data();
+                for(size_t r = 0; r < this->count; r++){ keys.push_back_unchecked(sort_key<field<I>>{values[r], r}); }
+                heap::heap_sort(keys.data(), this->count);
+                this->for_each_column([&keys, this](auto& column){ //sorted[r] = column[keys[r].row]
+                    std::remove_reference_t<decltype(column)> sorted;
+                    sorted.reserve_exact(this->count);
+                    for(size_t r = 0; r < this->count; r++){ sorted.push_back_unchecked(std::move(column[keys[r].row])); }
+                    column.swap(sorted);
+                });
+            }
+
+            template<size_t I> //O(log n), column I must be sorted (sort_by<I>)
+            size_t lower_bound(const field<I>& key) const { return binary::lower_bound(std::get<I>(this->columns).data(), key, this->count); } //first row with field I >= key, size() if none
+            template<size_t I> //O(log n), column I must be sorted (sort_by<I>)
+            size_t find(const field<I>& key) const { //a row with field I == key, size_t(-1) if none
+                size_t r = this->lower_bound<I>(key);
+                return (r < this->count && !(key < std::get<I>(this->columns)[r])) ? r : size_t(-1);
+            }
+
+            //column scans || O(n), over aligned contiguous memory
+            template<size_t I>
+            field<I> sum(void) const noexcept { //8 independent accumulators, so that the loop maps onto SIMD registers
+                constexpr size_t LANES = 8;
+                const field<I>* values = std::assume_aligned<ALIGNMENT>(std::get<I>(this->columns).data());
+                field<I> lanes[LANES] = {};
+                size_t r = 0;
+                for(; r + LANES <= this->count; r += LANES){ for(size_t l = 0; l < LANES; l++){ lanes[l] += values[r + l]; } }
+                field<I> total{};
+                for(size_t l = 0; l < LANES; l++){ total += lanes[l]; }
+                for(; r < this->count; r++){ total += values[r]; }
+                return total;
+            }
+            template<size_t I, class Predicate>
+            size_t count_if(Predicate predicate) const { //branch-free: the comparisons become vector masks
+                const field<I>* values = std::assume_aligned<ALIGNMENT>(std::get<I>(this->columns).data());
+                size_t total = 0;
+                for(size_t r = 0; r < this->count; r++){ total += bool(predicate(values[r])); }
+                return total;
+            }
+
+        private:
+            template<class Tuple, size_t... I>
+            void push_back(const Tuple& values, std::index_sequence<I...>){ //all or nothing: a throw leaves every column at size()
+                if(this->count == this->capacity()){ this->for_each_column([n = this->count + 1](auto& column){ column.reserve(n); }); } //a bad_alloc here adds no row
+                size_t pushed = 0; //columns holding the new row so far
+                try { ((std::get<I>(this->columns).push_back_unchecked(std::get<I>(values)), ++pushed), ...); }
+                catch(...){ //a field copy threw: take the row back out of the columns before it
+                    ((I < pushed ? std::get<I>(this->columns).pop_back() : void()), ...);
+                    throw;
+                }
+                ++this->count;
+            }
+    };
+}
+#endif
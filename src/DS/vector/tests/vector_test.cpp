@@ -0,0 +1,48 @@
+/* >=====> Vector Tests <=====< */
+//=> Checks, for DSA::vector and DSA::small_vector (inline and spilled), that a constructor throwing
+//=> inside emplace_back/push_back_unchecked leaves the size as it was: inside the capacity and through
+//=> the growth path (a counted but unconstructed slot would be destroyed twice).
+//=> Registered with ctest; exits non-zero on any failure.
+#include <stdexcept>
+#include <string>
+#include <fmt/core.h>
+#include <vector.hpp>
+#include <small_vector.hpp>
+
+struct fragile { //=> throws from its constructor, or from its copy when poisoned, after its string is built
+  std::string text;
+  bool poisoned = false;
+  fragile(const char* value, bool fail) : text(value) { if(fail){ throw std::runtime_error("Error: Construction failed!"); } }
+  fragile(const fragile& other) : text(other.text), poisoned(other.poisoned) { if(poisoned){ throw std::runtime_error("Error: Copy failed!"); } }
+  fragile(fragile&&) noexcept = default;
+};
+
+template<class Vector>
+bool survives_throwing_construction(void){ //=> inside the capacity, through push_back_unchecked and through growth
+  Vector values;
+  fragile poisoned("a long enough string to live on the heap", false);
+  poisoned.poisoned = true;
+  values.emplace_back("a long enough string to live on the heap", false);
+  try { values.emplace_back("another long string that lives on the heap", true); } catch(const std::runtime_error&){}
+  if(values.size() != 1){ return false; }
+  if(values.size() < values.capacity()){
+    try { values.push_back_unchecked(poisoned); } catch(const std::runtime_error&){}
+    if(values.size() != 1){ return false; }
+  }
+  while(values.size() < values.capacity()){ values.emplace_back("fill up to the capacity", false); }
+  size_t full = values.size();
+  try { values.emplace_back("and one past it, through the growth path", true); } catch(const std::runtime_error&){}
+  return values.size() == full && values[0].text[0] == 'a';
+}
+
+int main(void){
+  int failed = 0;
+  auto check = [&failed](const char* name, bool passed){
+    fmt::print("{:>48} | {}\n", name, passed ? "ok" : "FAILED");
+    failed += !passed;
+  };
+  check("DSA::vector throwing construction", survives_throwing_construction<DSA::vector<fragile>>());
+  check("DSA::small_vector<4> throwing construction", survives_throwing_construction<DSA::small_vector<fragile, 4>>());
+  check("DSA::small_vector<1> throwing construction", survives_throwing_construction<DSA::small_vector<fragile, 1>>());
+  return failed ? 1 : 0;
+}
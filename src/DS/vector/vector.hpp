@@ -0,0 +1,331 @@
+#ifndef VECTOR_HPP
+#define VECTOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#if defined(__linux__)
+  #include <sys/mman.h>
+  #include <unistd.h>
+  #define DSA_HAS_MREMAP 1
+#endif
+
+namespace DSA{
+    using size_t = long unsigned int;
+
+    /* >=====> Trivially Relocatable <=====< */
+    //=> A type whose objects can be moved to a new address with memcpy, leaving nothing to destroy at the
+    //=> old one. Every trivially copyable type is; specialize it for others that are, e.g. a struct
+    //=> holding a std::unique_ptr, so that a DSA::vector of them grows with realloc as well.
+    template<class T>
+    struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+    template<class T>
+    constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+    /* >=====> Allocators <=====< */
+    //=> Stateless, byte-oriented: allocate, deallocate, and reallocate, which may move the block and is only
+    //=> used for trivially relocatable elements. All of them throw std::bad_alloc on failure.
+    struct malloc_allocator { //=> realloc: grows in place when it can (and glibc remaps blocks it got from mmap)
+        static void* allocate(size_t bytes, size_t alignment){
+            void* block = alignment <= alignof(std::max_align_t) ? std::malloc(bytes) : std::aligned_alloc(alignment, (bytes + alignment - 1) & ~(alignment - 1));
+            if(!block){ throw std::bad_alloc(); }
+            return block;
+        }
+        static void* reallocate(void* block, size_t old_bytes, size_t bytes, size_t alignment){
+            if(alignment > alignof(std::max_align_t)){ //=> realloc only keeps malloc's alignment
+                void* moved = allocate(bytes, alignment);
+                std::memcpy(moved, block, std::min(old_bytes, bytes));
+                std::free(block);
+                return moved;
+            }
+            void* moved = std::realloc(block, bytes);
+            if(!moved){ throw std::bad_alloc(); }
+            return moved;
+        }
+        static void deallocate(void* block, size_t) noexcept { std::free(block); }
+    };
+
+    struct mmap_allocator { //=> whole pages from mmap, grown by mremap: the kernel moves page table entries, never the bytes
+#if defined(DSA_HAS_MREMAP)
+        static size_t pages(size_t bytes) noexcept {
+            static const size_t PAGE = size_t(::sysconf(_SC_PAGESIZE));
+            return (bytes + PAGE - 1) & ~(PAGE - 1);
+        }
+        static void* allocate(size_t bytes, size_t){ //=> page aligned, so any alignment up to the page size
+            void* block = ::mmap(nullptr, pages(bytes), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if(block == MAP_FAILED){ throw std::bad_alloc(); }
+            return block;
+        }
+        static void* reallocate(void* block, size_t old_bytes, size_t bytes, size_t){
+            if(pages(old_bytes) == pages(bytes)){ return block; }
+            void* moved = ::mremap(block, pages(old_bytes), pages(bytes), MREMAP_MAYMOVE);
+            if(moved == MAP_FAILED){ throw std::bad_alloc(); }
+            return moved;
+        }
+        static void deallocate(void* block, size_t bytes) noexcept { ::munmap(block, pages(bytes)); }
+#else //=> no mremap: the same as malloc_allocator
+        static void* allocate(size_t bytes, size_t alignment){ return malloc_allocator::allocate(bytes, alignment); }
+        static void* reallocate(void* block, size_t old_bytes, size_t bytes, size_t alignment){ return malloc_allocator::reallocate(block, old_bytes, bytes, alignment); }
+        static void deallocate(void* block, size_t bytes) noexcept { malloc_allocator::deallocate(block, bytes); }
+#endif
+    };
+
+    template<size_t ALIGNMENT, class Alloc = malloc_allocator>
+    struct aligned_allocator { //=> every block starts on an ALIGNMENT boundary, e.g. 64 for SIMD column scans
+        static_assert((ALIGNMENT & (ALIGNMENT - 1)) == 0, "Error: Alignment must be a power of two!");
+        static void* allocate(size_t bytes, size_t alignment){ return Alloc::allocate(bytes, std::max(alignment, ALIGNMENT)); }
+        static void* reallocate(void* block, size_t old_bytes, size_t bytes, size_t alignment){ return Alloc::reallocate(block, old_bytes, bytes, std::max(alignment, ALIGNMENT)); }
+        static void deallocate(void* block, size_t bytes) noexcept { Alloc::deallocate(block, bytes); }
+    };
+
+    /* >=====> Allocation Counting <=====< */
+    //=> counting_allocator<Alloc> forwards to Alloc and counts the calls, one set of counters per Alloc, e.g.
+    //=>     using counted = DSA::counting_allocator<>;
+    //=>     DSA::small_vector<int, 16, counted> v; ...; counted::counters.allocations == 0 while v stays inline
+    struct allocation_counters {
+        std::atomic<size_t> allocations{0}, reallocations{0}, deallocations{0}, bytes{0}; //bytes: requested by allocate and reallocate
+        void reset(void) noexcept { allocations = 0; reallocations = 0; deallocations = 0; bytes = 0; }
+    };
+
+    template<class Alloc = malloc_allocator>
+    struct counting_allocator {
+        static inline allocation_counters counters;
+        static void* allocate(size_t bytes, size_t alignment){
+            counters.allocations.fetch_add(1, std::memory_order_relaxed);
+            counters.bytes.fetch_add(bytes, std::memory_order_relaxed);
+            return Alloc::allocate(bytes, alignment);
+        }
+        static void* reallocate(void* block, size_t old_bytes, size_t bytes, size_t alignment){
+            counters.reallocations.fetch_add(1, std::memory_order_relaxed);
+            counters.bytes.fetch_add(bytes, std::memory_order_relaxed);
+            return Alloc::reallocate(block, old_bytes, bytes, alignment);
+        }
+        static void deallocate(void* block, size_t bytes) noexcept {
+            counters.deallocations.fetch_add(1, std::memory_order_relaxed);
+            Alloc::deallocate(block, bytes);
+        }
+    };
+
+    /* >=====> Growth Policies <=====< */
+    //=> The capacity after a push_back into a full vector is capacity * NUMERATOR / DENOMINATOR (at least MINIMUM).
+    //=> 3/2 (the default) lets freed blocks be reused by later growth, 2/1 halves the number of reallocations.
+    template<size_t NUMERATOR = 3, size_t DENOMINATOR = 2, size_t MINIMUM = 8>
+    struct growth_factor {
+        static_assert(NUMERATOR > DENOMINATOR, "Error: Growth factor must be greater than 1!");
+        static constexpr size_t next(size_t capacity, size_t required) noexcept {
+            return std::max({required, capacity / DENOMINATOR * NUMERATOR + capacity % DENOMINATOR * NUMERATOR / DENOMINATOR, MINIMUM});
+        }
+    };
+    using doubling = growth_factor<2, 1>;
+
+    /* >=====> Vector Base <=====< */
+    //=> What DSA::vector and DSA::small_vector share: everything that only reads and writes elements,
+    //=> count and space. Where the elements live is the derived class's business, reached through
+    //=> Derived::grow(required) (CRTP, no virtual calls), which must leave capacity() >= required.
+    template<class Derived, class T>
+    class vector_base {
+        protected:
+            T* elements = nullptr;
+            size_t count = 0;
+            size_t space = 0; //capacity
+
+            vector_base() = default;
+            vector_base(const vector_base&) = delete; //the derived class owns the storage and copies it
+            vector_base& operator=(const vector_base&) = delete;
+            ~vector_base() = default;
+
+            void grow(size_t required){ static_cast<Derived*>(this)->grow(required); }
+
+        public:
+            using value_type = T;
+            using iterator = T*;
+            using const_iterator = const T*;
+
+            //accessing
+            T& operator[](size_t index) noexcept { return this->elements[index]; } //access by []
+            const T& operator[](size_t index) const noexcept { return this->elements[index]; } //access by []
+
+            T& at(size_t index){ // access by a function with an exception
+                if(index >= this->count){ throw std::out_of_range("Error: Index is out of range!"); }
+                return this->elements[index];
+            }
+            const T& at(size_t index) const { // access by a function with an exception
+                if(index >= this->count){ throw std::out_of_range("Error: Index is out of range!"); }
+                return this->elements[index];
+            }
+
+            T& front(void) noexcept { return this->elements[0]; } // access 1st element
+            const T& front(void) const noexcept { return this->elements[0]; } // access 1st element
+            T& back(void) noexcept { return this->elements[this->count - 1]; } //access last element
+            const T& back(void) const noexcept { return this->elements[this->count - 1]; } //access last element
+
+            T* begin(void) noexcept { return this->elements; } //access by first memory address
+            const T* begin(void) const noexcept { return this->elements; } //access by first memory address
+            const T* cbegin(void) const noexcept { return this->elements; } //access by first memory address
+            T* end(void) noexcept { return this->elements + this->count; } //access by last memory address
+            const T* end(void) const noexcept { return this->elements + this->count; } //access by last memory address
+            const T* cend(void) const noexcept { return this->elements + this->count; } //access by last memory address
+
+            std::reverse_iterator<T*> rbegin(void) noexcept { return std::reverse_iterator<T*>(this->end()); } //access by last element
+            std::reverse_iterator<const T*> rbegin(void) const noexcept { return std::reverse_iterator<const T*>(this->end()); } //access by last element
+            std::reverse_iterator<T*> rend(void) noexcept { return std::reverse_iterator<T*>(this->begin()); } //access before first element
+            std::reverse_iterator<const T*> rend(void) const noexcept { return std::reverse_iterator<const T*>(this->begin()); } //access before first element
+
+            //c-style array
+            T* data(void) noexcept { return this->elements; } //access the raw c-style array
+            const T* data(void) const noexcept { return this->elements; } //access the raw c-style array
+
+            //size and capacity
+            size_t size(void) const noexcept { return this->count; }
+            size_t capacity(void) const noexcept { return this->space; }
+            static constexpr size_t max_size(void) noexcept { return size_t(-1) / 2 / sizeof(T); }
+            bool empty(void) const noexcept { return this->count == 0; }
+
+            void reserve(size_t capacity){ //room for at least capacity elements, rounded up by the growth factor
+                if(capacity > this->space){ this->grow(capacity); }
+            }
+
+            //operations
+            void push_back(const T& value){ this->emplace_back(value); }
+            void push_back(T&& value){ this->emplace_back(std::move(value)); }
+
+            template<class... Args>
+            T& emplace_back(Args&&... args){ //amortized O(1)
+                if(this->count == this->space) [[unlikely]] {
+                    T element(std::forward<Args>(args)...); //args may refer into this vector
+                    this->grow(this->count + 1);
+                    T& added = *std::construct_at(this->elements + this->count, std::move(element));
+                    ++this->count; //only once constructed: a throw leaves size() as it was
+                    return added;
+                }
+                T& added = *std::construct_at(this->elements + this->count, std::forward<Args>(args)...);
+                ++this->count;
+                return added;
+            }
+
+            void push_back_unchecked(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>) { //requires size() < capacity()
+                std::construct_at(this->elements + this->count, value);
+                ++this->count;
+            }
+            void push_back_unchecked(T&& value) noexcept(std::is_nothrow_move_constructible_v<T>) { //requires size() < capacity()
+                std::construct_at(this->elements + this->count, std::move(value));
+                ++this->count;
+            }
+
+            void append(const T* values, size_t n){ //n elements at once, one memcpy for trivially copyable ones (values must not point into this vector)
+                if(this->count + n > this->space){ this->grow(this->count + n); }
+                if constexpr (std::is_trivially_copyable_v<T>){ if(n){ std::memcpy(static_cast<void*>(this->elements + this->count), values, n * sizeof(T)); } }
+                else { std::uninitialized_copy_n(values, n, this->elements + this->count); }
+                this->count += n;
+            }
+
+            void pop_back(void) noexcept { std::destroy_at(this->elements + --this->count); } //requires !empty()
+
+            void resize(size_t size){ //new elements are value-initialized
+                if(size > this->space){ this->reserve(size); }
+                if(size > this->count){ std::uninitialized_value_construct_n(this->elements + this->count, size - this->count); }
+                else { std::destroy_n(this->elements + size, this->count - size); }
+                this->count = size;
+            }
+            void resize(size_t size, const T& value){ //new elements are copies of value
+                if(size > this->space){
+                    T copy(value); //value may refer into this vector
+                    this->reserve(size);
+                    std::uninitialized_fill_n(this->elements + this->count, size - this->count, copy);
+                }
+                else if(size > this->count){ std::uninitialized_fill_n(this->elements + this->count, size - this->count, value); }
+                else { std::destroy_n(this->elements + size, this->count - size); }
+                this->count = size;
+            }
+
+            void clear(void) noexcept { std::destroy_n(this->elements, this->count); this->count = 0; } //keeps the capacity
+
+            friend bool operator==(const Derived& left, const Derived& right){ return std::equal(left.begin(), left.end(), right.begin(), right.end()); }
+    };
+
+    /* >=====> Vector <=====< */
+    //=> A growable array. Trivially relocatable elements are grown with Alloc::reallocate (realloc by
+    //=> default, mremap with mmap_allocator), so growing does not have to copy the elements; others are
+    //=> moved (or copied, if their move may throw) into a new block.
+    //=> push_back_unchecked skips the capacity test, for loops after a reserve that covers them.
+    template<class T, class Alloc = malloc_allocator, class Growth = growth_factor<>>
+    class vector : public vector_base<vector<T, Alloc, Growth>, T> {
+        private:
+            friend vector_base<vector, T>; //calls grow
+            static constexpr bool RELOCATABLE = is_trivially_relocatable_v<T>;
+
+            void reallocate(size_t capacity){ //capacity >= count
+                if constexpr (RELOCATABLE){
+                    if(this->elements){ this->elements = static_cast<T*>(Alloc::reallocate(this->elements, this->space * sizeof(T), capacity * sizeof(T), alignof(T))); }
+                    else { this->elements = static_cast<T*>(Alloc::allocate(capacity * sizeof(T), alignof(T))); }
+                }
+                else {
+                    T* moved = static_cast<T*>(Alloc::allocate(capacity * sizeof(T), alignof(T)));
+                    try { //copies instead if the move may throw, so that a failure leaves this vector as it was
+                        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>){ std::uninitialized_move_n(this->elements, this->count, moved); }
+                        else { std::uninitialized_copy_n(this->elements, this->count, moved); }
+                    }
+                    catch(...) { Alloc::deallocate(moved, capacity * sizeof(T)); throw; }
+                    std::destroy_n(this->elements, this->count);
+                    if(this->elements){ Alloc::deallocate(this->elements, this->space * sizeof(T)); }
+                    this->elements = moved;
+                }
+                this->space = capacity;
+            }
+            void grow(size_t required){ //at least required, by the growth factor
+                if(required > this->max_size()){ throw std::length_error("Error: Size is exceeded!"); }
+                this->reallocate(std::min(Growth::next(this->space, required), this->max_size()));
+            }
+            void release(void) noexcept {
+                std::destroy_n(this->elements, this->count);
+                if(this->elements){ Alloc::deallocate(this->elements, this->space * sizeof(T)); }
+                this->elements = nullptr;
+                this->count = this->space = 0;
+            }
+
+        public:
+            /*assigning*/
+            vector() = default; //declaration
+            explicit vector(size_t size) : vector() { this->resize(size); } //size value-initialized elements
+            vector(size_t size, const T& value) : vector() { this->resize(size, value); } //size copies of value
+            vector(std::initializer_list<T> list) : vector() { this->append(list.begin(), list.size()); } //assigning with a list
+            vector(const vector& other) : vector() { this->append(other.elements, other.count); } //copying (delegating: a throw frees what was built)
+            vector(vector&& other) noexcept { this->swap(other); } //moving, O(1)
+
+            vector& operator=(const vector& other){ //assigning with an other object (Copy constructure)
+                if(this != &other){ vector(other).swap(*this); }
+                return *this;
+            }
+            vector& operator=(vector&& other) noexcept { vector(std::move(other)).swap(*this); return *this; }
+            vector& operator=(std::initializer_list<T> list){ vector(list).swap(*this); return *this; }
+            ~vector(){ this->release(); } //destructor
+
+            //size and capacity
+            void reserve_exact(size_t capacity){ //room for exactly capacity elements, when the final size is known
+                if(capacity > this->max_size()){ throw std::length_error("Error: Size is exceeded!"); }
+                if(capacity > this->space){ this->reallocate(capacity); }
+            }
+            void shrink_to_fit(void){ //capacity == size
+                if(this->count == this->space){ return; }
+                if(this->count == 0){ this->release(); return; }
+                this->reallocate(this->count);
+            }
+
+            //operations
+            void swap(vector& other) noexcept {
+                std::swap(this->elements, other.elements);
+                std::swap(this->count, other.count);
+                std::swap(this->space, other.space);
+            }
+    };
+}
+#endif
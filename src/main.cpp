@@ -154,7 +154,9 @@ int main(int argc, char **args) {
   // 1. bubble(arr, N);
   // 2. selection(arr, N);
   // 3. insertion(arr, N);
-  merge_sort(arr, 0, N - 1);
+  if (N > 1) {
+    merge_sort(arr, 0, N - 1); //=> N - 1 underflows when N = 0
+  }
   //=> Outputing
   print("Result: ");
   for (size_t i = 0; i < N; i++) {